@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_CURVE_H_
+#define PRIVATE_DSP_CURVE_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Block-oriented kernels for evaluating the fitted transfer polynomial.
+         * Implementations are resolved once at startup the same way lsp-dsp-lib
+         * resolves dsp::* functions: generic C++ fallback overridden by the best
+         * available SIMD variant (SSE2/AVX2/AVX-512 on x86, NEON on AArch64).
+         */
+        namespace curve
+        {
+            /**
+             * Evaluate polynomial for a block of samples using Horner's scheme:
+             *   dst[i] = c[order]*src[i]^order + ... + c[1]*src[i] + c[0]
+             *
+             * @param dst destination buffer, may be the same as src
+             * @param src source buffer
+             * @param c polynomial coefficients, c[0] is the constant term
+             * @param order polynomial order, number of coefficients is order+1
+             * @param count number of samples to process
+             */
+            typedef void (* polyeval_t)(float *dst, const float *src, const float *c, size_t order, size_t count);
+
+            /**
+             * Evaluate the transfer curve for a block of samples using a dense
+             * lookup table spanning [-1, 1] with linear interpolation between
+             * adjacent entries. Input values outside of [-1, 1] are clamped to
+             * the table boundaries.
+             *
+             * @param dst destination buffer, may be the same as src
+             * @param src source buffer
+             * @param lut lookup table, lut[0] = f(-1), lut[size-1] = f(1)
+             * @param size number of table entries, at least 2
+             * @param count number of samples to process
+             */
+            typedef void (* lut_process_t)(float *dst, const float *src, const float *lut, size_t size, size_t count);
+
+            /**
+             * Crossfade two evaluated curve blocks with a linear ramp:
+             *   dst[i] = a[i] + (b[i] - a[i]) * (t0 + i*dt)
+             *
+             * @param dst destination buffer, may be the same as a or b
+             * @param a source buffer faded out
+             * @param b source buffer faded in
+             * @param t0 initial mix coefficient
+             * @param dt per-sample mix coefficient increment
+             * @param count number of samples to process
+             */
+            typedef void (* xfade_t)(float *dst, const float *a, const float *b, float t0, float dt, size_t count);
+
+            /**
+             * Paired variant of polyeval for two channels sharing one set of
+             * coefficients: both buffers are evaluated in a single pass so the
+             * coefficient broadcasts are loaded once and the SIMD lanes of wide
+             * architectures are fully utilized on stereo content.
+             */
+            typedef void (* polyeval_x2_t)(float *dst_l, float *dst_r, const float *src_l, const float *src_r, const float *c, size_t order, size_t count);
+
+            /**
+             * Paired variant of lut_process for two channels sharing one table
+             */
+            typedef void (* lut_process_x2_t)(float *dst_l, float *dst_r, const float *src_l, const float *src_r, const float *lut, size_t size, size_t count);
+
+            /**
+             * Fused variant of polyeval that scales the evaluated curve by a
+             * constant gain in the same pass:
+             *   dst[i] = k * P(src[i])
+             * Saves one full traversal of the block compared to a separate
+             * dsp::mul_k2 pass, which matters on small host blocks.
+             */
+            typedef void (* polyeval_k_t)(float *dst, const float *src, const float *c, size_t order, float k, size_t count);
+
+            /**
+             * Fused variant of lut_process that scales the interpolated curve
+             * by a constant gain in the same pass
+             */
+            typedef void (* lut_process_k_t)(float *dst, const float *src, const float *lut, size_t size, float k, size_t count);
+
+            /**
+             * Paired variant of polyeval_k for two channels sharing one set of
+             * coefficients and one gain value
+             */
+            typedef void (* polyeval_k_x2_t)(float *dst_l, float *dst_r, const float *src_l, const float *src_r, const float *c, size_t order, float k, size_t count);
+
+            /**
+             * Paired variant of lut_process_k for two channels sharing one table
+             */
+            typedef void (* lut_process_k_x2_t)(float *dst_l, float *dst_r, const float *src_l, const float *src_r, const float *lut, size_t size, float k, size_t count);
+
+            /**
+             * Fused shape + gain + dry mix:
+             *   dst[i] = kwet * P(src[i]) + kdry * dry[i]
+             * Produces the final mixed sample in one pass over the block
+             * instead of separate evaluate, scale and mix traversals.
+             */
+            typedef void (* polyeval_mix_t)(float *dst, const float *src, const float *dry, const float *c, size_t order, float kwet, float kdry, size_t count);
+
+            /**
+             * Fused table lookup + gain + dry mix, the LUT-mode counterpart of
+             * polyeval_mix
+             */
+            typedef void (* lut_process_mix_t)(float *dst, const float *src, const float *dry, const float *lut, size_t size, float kwet, float kdry, size_t count);
+
+            /**
+             * First-order antiderivative antialiasing (ADAA) evaluation of
+             * the transfer polynomial with the output gain fused in:
+             *   dst[i] = k * (F(x[i]) - F(x[i-1])) / (x[i] - x[i-1])
+             * where F is the antiderivative of the fitted polynomial; when
+             * consecutive samples nearly coincide the ill-conditioned
+             * quotient is replaced by the midpoint evaluation k * P((x[i] +
+             * x[i-1]) / 2). Runs at 1x sample rate as an alternative to the
+             * oversampled path. The caller owns the single-sample history:
+             * x1 is the last input sample of the previous block.
+             *
+             * @param dst destination buffer, may be the same as src
+             * @param src source buffer
+             * @param c polynomial coefficients, c[0] is the constant term
+             * @param ic antiderivative coefficients, order+2 values, ic[0] = 0
+             * @param order polynomial order of the transfer function
+             * @param k output gain
+             * @param x1 input sample preceding src[0]
+             * @param count number of samples to process
+             */
+            typedef void (* adaa_t)(float *dst, const float *src, const float *c, const float *ic, size_t order, float k, float x1, size_t count);
+
+            /**
+             * Pointers to the active implementations, initialized by curve::init()
+             */
+            extern polyeval_t       polyeval;
+            extern lut_process_t    lut_process;
+            extern xfade_t          xfade;
+            extern polyeval_x2_t    polyeval_x2;
+            extern lut_process_x2_t lut_process_x2;
+            extern polyeval_k_t     polyeval_k;
+            extern lut_process_k_t  lut_process_k;
+            extern polyeval_k_x2_t  polyeval_k_x2;
+            extern lut_process_k_x2_t lut_process_k_x2;
+            extern polyeval_mix_t   polyeval_mix;
+            extern lut_process_mix_t lut_process_mix;
+            extern adaa_t           adaa;
+
+            /**
+             * Reference (non-SIMD) implementations of the dispatched kernels,
+             * exposed so the test suites can validate and A/B benchmark the
+             * SIMD variants against the scalar baseline on any architecture.
+             * Production code always calls the dispatched pointers above.
+             */
+            typedef struct generic_t
+            {
+                polyeval_t          polyeval;
+                lut_process_t       lut_process;
+                xfade_t             xfade;
+                polyeval_x2_t       polyeval_x2;
+                lut_process_x2_t    lut_process_x2;
+                polyeval_k_t        polyeval_k;
+                lut_process_k_t     lut_process_k;
+                polyeval_k_x2_t     polyeval_k_x2;
+                lut_process_k_x2_t  lut_process_k_x2;
+                polyeval_mix_t      polyeval_mix;
+                lut_process_mix_t   lut_process_mix;
+                adaa_t              adaa;
+            } generic_t;
+
+            extern const generic_t  generic;
+
+            /**
+             * Least-squares fit of a polynomial of the given order to the
+             * passed sample points, solving the normal equations with Gauss
+             * elimination and partial pivoting. Plain scalar double-precision
+             * math: the solve runs once per parameter change on a worker
+             * thread, its conditioning matters more than its speed.
+             *
+             * @param coeffs order+1 output coefficients, c[0] is the constant term
+             * @param matrix caller-provided workspace of (order+1)*(order+2) doubles
+             * @param x sample point abscissas
+             * @param y sample point values
+             * @param np number of sample points, at least order+1
+             * @param order polynomial order
+             */
+            void polyfit(float *coeffs, double *matrix, const double *x, const double *y, size_t np, size_t order);
+
+            /**
+             * Resolve a fused shape+gain evaluator specialized for the given
+             * polynomial order. For the orders preset material clusters at
+             * (4, 6, 8, 12, 16) the returned function is a template
+             * instantiation with a compile-time trip count, so the Horner
+             * recurrence is fully unrolled and register-resident; any other
+             * order falls back to the runtime-loop kernel. The specialized
+             * evaluators ignore their order argument.
+             *
+             * @param order polynomial order the evaluator will be called with
+             * @return evaluator matching the polyeval_k_t signature
+             */
+            polyeval_k_t            polyeval_k_resolve(size_t order);
+
+            /**
+             * Paired counterpart of polyeval_k_resolve
+             */
+            polyeval_k_x2_t         polyeval_k_x2_resolve(size_t order);
+
+            /**
+             * Resolve the best implementations for the runtime architecture.
+             * May be called multiple times, only the first call takes effect.
+             */
+            void                    init();
+
+            /**
+             * Name of the implementation family selected by init(), e.g.
+             * "generic", "sse2", "avx2", "avx512" or "neon". When the kernel
+             * families resolve to different generations (AVX-512 rebinds only
+             * the polynomial evaluators, SSE2 covers neither the lookup nor
+             * the ADAA kernels), the tag names each family separately, e.g.
+             * "poly=avx512 lut=avx2 adaa=avx2". Benchmark output records it
+             * so baselines gathered on different architectures stay
+             * comparable.
+             */
+            const char             *impl_name();
+
+        } /* namespace curve */
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_CURVE_H_ */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_CURVE_CACHE_H_
+#define PRIVATE_DSP_CURVE_CACHE_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        namespace curve
+        {
+            /**
+             * Process-wide cache of fitted curves keyed by the quantized fit
+             * parameters. Template-instantiated sessions run dozens of shaper
+             * instances with identical settings; instead of each instance
+             * solving its own normal equations and rendering a private lookup
+             * table, the fit task probes the cache and shares one immutable,
+             * refcounted curve object. Sharing the LUT memory also keeps one
+             * hot table resident in L2 instead of thrashing per-instance
+             * copies.
+             *
+             * The cache is accessed from worker threads only (fit tasks and
+             * instance teardown); the audio thread never touches it, it only
+             * reads through pointers held alive by the reference counts.
+             */
+
+            /**
+             * Immutable fitted curve shared between instances. Fields are
+             * valid until the matching cache_release() call.
+             */
+            typedef struct shared_t
+            {
+                const float    *vCoeffs;        // Polynomial coefficients
+                size_t          nOrder;         // Polynomial order
+                const float    *vLut;           // Rendered lookup table, NULL if not rendered yet
+                size_t          nLutSize;       // Number of lookup table entries
+            } shared_t;
+
+            /**
+             * Probe the cache for a curve fitted with the passed parameters,
+             * quantized to the port step. On a hit the reference count is
+             * incremented and the shared curve is returned; on a miss the
+             * caller is expected to perform the fit and offer the result
+             * through cache_commit().
+             *
+             * @return acquired shared curve or NULL on a cache miss
+             */
+            shared_t       *cache_acquire(float hscale, float hshift, float vscale, float vshift, size_t order);
+
+            /**
+             * Offer a freshly fitted curve to the cache. The coefficient and
+             * lookup table data is copied into cache-owned storage. If another
+             * thread committed the same key meanwhile, that entry is acquired
+             * instead. Returns NULL when the cache is full of referenced
+             * entries, in which case the caller keeps using its private data.
+             *
+             * @param coeffs order+1 polynomial coefficients
+             * @param lut rendered lookup table, may be NULL
+             * @param lut_size number of lookup table entries
+             * @return acquired shared curve or NULL
+             */
+            shared_t       *cache_commit(float hscale, float hshift, float vscale, float vshift, size_t order,
+                                const float *coeffs, const float *lut, size_t lut_size);
+
+            /**
+             * Attach a rendered lookup table to a shared curve that was
+             * cached without one (fitted by a polynomial-mode instance).
+             * Does nothing if the table is already present.
+             */
+            void            cache_attach_lut(shared_t *s, const float *lut, size_t lut_size);
+
+            /**
+             * Release a reference to a shared curve. Unreferenced entries
+             * stay cached and become reusable for other keys.
+             */
+            void            cache_release(shared_t *s);
+
+        } /* namespace curve */
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_CURVE_CACHE_H_ */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_CURVE_POOL_H_
+#define PRIVATE_DSP_CURVE_POOL_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/ipc/ITask.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        namespace curve
+        {
+            /**
+             * Process-wide worker pool for curve production jobs (matrix
+             * solves, LUT renders, graph rasters). Each plugin instance owns
+             * an executor provided by its wrapper, but a session automating
+             * dozens of shaper instances at once would then fit dozens of
+             * curves concurrently, oversubscribing the machine right when the
+             * audio threads need it most. The pool bounds the total
+             * background CPU to a few worker threads shared by all instances
+             * and serves instances that currently produce sound before
+             * bypassed ones, keeping refit latency predictable when one macro
+             * control drives the whole session.
+             *
+             * The worker count defaults to the number of system cores minus a
+             * reservation for the host audio threads and may be overridden
+             * through the LSP_SHAPER_POOL_SIZE environment variable; setting
+             * it to 0 disables the pool entirely, in which case submissions
+             * fail and the caller falls back to the wrapper executor.
+             */
+
+            /**
+             * Register a plugin instance with the pool, starting the worker
+             * threads on the first call. Must be balanced with pool_unbind().
+             *
+             * @return false when no workers could be started, in which case
+             *   pool_submit() will always fail for this process
+             */
+            bool            pool_bind();
+
+            /**
+             * Unregister a plugin instance; the last unbind stops and joins
+             * the worker threads
+             */
+            void            pool_unbind();
+
+            /**
+             * Submit a task for background execution. The task must be in
+             * idle state, the same contract as ipc::IExecutor::submit().
+             * Urgent tasks (instances currently producing sound) are served
+             * before relaxed ones (bypassed instances).
+             *
+             * @param task task to execute
+             * @param urgent true to place the task in the priority queue
+             * @return true if the task was queued
+             */
+            bool            pool_submit(ipc::ITask *task, bool urgent);
+
+            /**
+             * Withdraw a task during instance teardown: a task still queued
+             * is unlinked and returned to idle state, a task already running
+             * is waited for. After the call the pool holds no reference to
+             * the task.
+             */
+            void            pool_cancel(ipc::ITask *task);
+
+        } /* namespace curve */
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_CURVE_POOL_H_ */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_META_SHAPER_H_
+#define PRIVATE_META_SHAPER_H_
+
+#include <lsp-plug.in/plug-fw/meta/types.h>
+#include <lsp-plug.in/plug-fw/const.h>
+
+namespace lsp
+{
+    namespace meta
+    {
+        // Shaper metadata
+        struct shaper
+        {
+            static constexpr float  IN_GAIN_MIN         = GAIN_AMP_M_36_DB;
+            static constexpr float  IN_GAIN_MAX         = GAIN_AMP_P_36_DB;
+            static constexpr float  IN_GAIN_DFL         = GAIN_AMP_0_DB;
+            static constexpr float  IN_GAIN_STEP        = 0.01f;
+
+            static constexpr float  OUT_GAIN_MIN        = GAIN_AMP_M_36_DB;
+            static constexpr float  OUT_GAIN_MAX        = GAIN_AMP_P_36_DB;
+            static constexpr float  OUT_GAIN_DFL        = GAIN_AMP_0_DB;
+            static constexpr float  OUT_GAIN_STEP       = 0.01f;
+
+            static constexpr float  HSCALE_MIN          = 0.0f;
+            static constexpr float  HSCALE_MAX          = 8.0f;
+            static constexpr float  HSCALE_DFL          = 1.0f;
+            static constexpr float  HSCALE_STEP         = 0.001f;
+
+            static constexpr float  HSHIFT_MIN          = -1.0f;
+            static constexpr float  HSHIFT_MAX          = 1.0f;
+            static constexpr float  HSHIFT_DFL          = 0.0f;
+            static constexpr float  HSHIFT_STEP         = 0.001f;
+
+            static constexpr float  VSCALE_MIN          = 0.0f;
+            static constexpr float  VSCALE_MAX          = 8.0f;
+            static constexpr float  VSCALE_DFL          = 1.0f;
+            static constexpr float  VSCALE_STEP         = 0.001f;
+
+            static constexpr float  VSHIFT_MIN          = -1.0f;
+            static constexpr float  VSHIFT_MAX          = 1.0f;
+            static constexpr float  VSHIFT_DFL          = 0.0f;
+            static constexpr float  VSHIFT_STEP         = 0.001f;
+
+            static constexpr float  MORPH_MIN           = 0.0f;
+            static constexpr float  MORPH_MAX           = 1.0f;
+            static constexpr float  MORPH_DFL           = 0.0f;
+            static constexpr float  MORPH_STEP          = 0.001f;
+
+            static constexpr int    ORDER_MIN           = 2;
+            static constexpr int    ORDER_MAX           = 32;
+            static constexpr int    ORDER_DFL           = 8;
+
+            static constexpr size_t OVERSAMPLING_DFL    = 0;
+            static constexpr size_t OVERSAMPLING_MAX    = 8;
+
+            static constexpr size_t OVS_QUALITY_DFL     = 0;
+
+            static constexpr float  AUTO_OVS_ON_LEVEL   = GAIN_AMP_M_36_DB; // Peak level engaging the oversampler in auto mode
+            static constexpr float  AUTO_OVS_OFF_LEVEL  = GAIN_AMP_M_42_DB; // Peak level releasing the oversampler in auto mode
+
+            static constexpr float  DITHER_DC           = 1e-8f;    // DC keeping filter states out of the denormal range, -160 dB
+
+            static constexpr size_t CURVE_MODE_DFL      = 0;
+            static constexpr size_t CURVE_LUT_SIZE      = 8192;
+
+            static constexpr float  CURVE_XFADE_TIME    = 5.0f;     // Curve crossfade time in ms
+            static constexpr float  CURVE_SETTLE_TIME   = 20.0f;    // Quiet period coalescing parameter bursts into one refit, ms
+
+            static constexpr size_t GRAPH_DOTS          = 400;
+            static constexpr float  GRAPH_DB_MIN        = -72.0f;
+            static constexpr float  GRAPH_DB_MAX        = 0.0f;
+
+        #ifdef LSP_SHAPER_PROFILING
+            static constexpr float  PROFILE_MIN         = 0.0f;     // Stage time meter range, microseconds
+            static constexpr float  PROFILE_MAX         = 100000.0f;
+            static constexpr float  PROFILE_DFL         = 0.0f;
+            static constexpr float  PROFILE_STEP        = 0.01f;
+        #endif /* LSP_SHAPER_PROFILING */
+        };
+
+        // Plugin type metadata
+        extern const plugin_t shaper_mono;
+        extern const plugin_t shaper_stereo;
+
+    } /* namespace meta */
+} /* namespace lsp */
+
+#endif /* PRIVATE_META_SHAPER_H_ */
@@ -0,0 +1,376 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_SHAPER_H_
+#define PRIVATE_PLUGINS_SHAPER_H_
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/dsp-units/ctl/Bypass.h>
+#include <lsp-plug.in/dsp-units/util/Delay.h>
+#include <lsp-plug.in/dsp-units/util/Oversampler.h>
+#include <lsp-plug.in/ipc/ITask.h>
+#include <lsp-plug.in/plug-fw/core/IDBuffer.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+
+#include <private/dsp/curve.h>
+#include <private/dsp/curve_cache.h>
+#include <private/meta/shaper.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Shaper plugin: wave shaping based on polynomial approximation
+         * of a parametrized sigmoid transfer function
+         */
+        class shaper: public plug::Module
+        {
+            protected:
+                enum constants_t
+                {
+                    CHUNK_SIZE_MIN  = 0x40,             // Smallest internal processing chunk
+                    CHUNK_SIZE_MAX  = 0x1000,           // Largest internal processing chunk, buffers are allocated for it
+                    CHUNK_CACHE_BUDGET  = 0x40000,      // Working-set budget for chunk selection, bytes
+                    CURVES_TOTAL    = 3,                // Active + fading + fit target
+                    OVS_LATENCY_MAX = 0x200             // Upper bound of the oversampler latency, samples at base rate
+                };
+
+                enum curve_mode_t
+                {
+                    CM_POLY,                            // Direct polynomial evaluation
+                    CM_LUT                              // Lookup table with linear interpolation
+                };
+
+                enum ovs_quality_t
+                {
+                    OQ_NORMAL,                          // Long kernels, best stopband rejection
+                    OQ_LOW_LATENCY                      // Short kernels, roughly half the added latency
+                };
+
+                enum snapshot_flags_t
+                {
+                    SF_BYPASS       = 1 << 0,           // Bypass enabled
+                    SF_LISTEN       = 1 << 1,           // Monitor the shaping residue (wet minus dry)
+                    SF_DITHER       = 1 << 2            // Anti-denormal dither enabled
+                };
+
+                /**
+                 * Consolidated snapshot of all DSP-relevant parameter values,
+                 * sized to fit a couple of cache lines. The framework-facing
+                 * side packs it in update_settings() and publishes it under a
+                 * sequence counter; the audio thread consumes at most one
+                 * snapshot per process() call instead of a long chain of
+                 * per-port reads
+                 */
+                typedef struct snapshot_t
+                {
+                    float               fGainIn;        // Input gain
+                    float               fGainOut;       // Output gain
+                    float               fHScale;        // Horizontal scale
+                    float               fHShift;        // Horizontal shift
+                    float               fVScale;        // Vertical scale
+                    float               fVShift;        // Vertical shift
+                    float               fHScaleB;       // Horizontal scale, morph endpoint B
+                    float               fHShiftB;       // Horizontal shift, morph endpoint B
+                    float               fVScaleB;       // Vertical scale, morph endpoint B
+                    float               fVShiftB;       // Vertical shift, morph endpoint B
+                    float               fMorph;         // Morph position between the fitted endpoints
+                    uint32_t            nOrder;         // Polynomial order
+                    uint32_t            nCurveMode;     // Curve evaluation mode
+                    uint32_t            nOversampling;  // Oversampling mode index
+                    uint32_t            nOvsQuality;    // Oversampling quality mode
+                    uint32_t            nFlags;         // Switch states, see snapshot_flags_t
+                } snapshot_t;
+
+                /**
+                 * Snapshot of the parameters that define the transfer curve,
+                 * taken on the audio thread and consumed by the fit task
+                 */
+                typedef struct curve_params_t
+                {
+                    float               fHScale;        // Horizontal scale
+                    float               fHShift;        // Horizontal shift
+                    float               fVScale;        // Vertical scale
+                    float               fVShift;        // Vertical shift
+                    float               fHScaleB;       // Horizontal scale, morph endpoint B
+                    float               fHShiftB;       // Horizontal shift, morph endpoint B
+                    float               fVScaleB;       // Vertical scale, morph endpoint B
+                    float               fVShiftB;       // Vertical shift, morph endpoint B
+                    size_t              nOrder;         // Polynomial order
+                    size_t              nMode;          // Curve evaluation mode
+                } curve_params_t;
+
+                /**
+                 * Fitted curve state, produced by the background fit task and
+                 * installed on the audio thread as a whole. Curves are shared:
+                 * all linked channels evaluate the same object, and the
+                 * reference counter tracks how many roles (active, fading,
+                 * fit target) currently hold it, so a free buffer can be
+                 * picked for the next fit while a crossfade is still running
+                 */
+                typedef struct curve_t
+                {
+                    // Hot: dispatch data the evaluation kernels read on every
+                    // chunk, laid out at the head of the structure. The
+                    // coefficient arrays are flat scalar sequences in degree
+                    // order, broadcast term by term by the SIMD kernels
+                    curve::polyeval_k_t pEvalK;         // Evaluator resolved for nOrder, unrolled for common orders
+                    curve::polyeval_k_x2_t pEvalKX2;    // Paired evaluator resolved for nOrder
+                    float              *vLut;           // Active lookup table: vLutLocal or a process-wide shared table
+                    size_t              nOrder;         // Polynomial order
+                    size_t              nMode;          // Curve evaluation mode
+                    float               vCoeffs[meta::shaper::ORDER_MAX + 1];   // Polynomial coefficients
+                    float               vAdaaCoeffs[meta::shaper::ORDER_MAX + 2];   // Antiderivative coefficients for the ADAA kernel
+                    float               vMorphCoeffs[meta::shaper::ORDER_MAX + 1];  // Interpolated coefficients, valid for fMorphApplied
+                    float               vMorphAdaaCoeffs[meta::shaper::ORDER_MAX + 2];  // Interpolated antiderivative coefficients
+
+                    // Cold: bookkeeping and UI-facing data, touched at most
+                    // once per block
+                    float               vCoeffsB[meta::shaper::ORDER_MAX + 1];  // Endpoint B polynomial coefficients
+                    float               vAdaaCoeffsB[meta::shaper::ORDER_MAX + 2];  // Endpoint B antiderivative coefficients
+                    float               fMorphApplied;  // Morph position the interpolated arrays were built for, negative when stale
+                    size_t              nVersion;       // Curve generation, advanced on each install
+                    size_t              nRefs;          // References held by curve roles, audio thread only
+                    float              *vLutLocal;      // Instance-owned lookup table storage
+                    curve::shared_t    *pShared;        // Reference to the process-wide cached curve, may be NULL
+                    float              *vLinGraph;      // Linear graph: output values
+                    float              *vLogGraph;      // Logarithmic graph: output values (dB), allocated lazily
+                } curve_t;
+
+                /**
+                 * Background task that performs the curve fit and rendering
+                 * of LUT and graph data off the audio thread
+                 */
+                class CurveTask: public ipc::ITask
+                {
+                    private:
+                        shaper             *pCore;
+
+                    public:
+                        explicit CurveTask(shaper *core);
+
+                    public:
+                        virtual status_t    run() override;
+                };
+
+            #ifdef LSP_SHAPER_PROFILING
+                /**
+                 * Lock-free per-stage timing aggregate: written by the audio
+                 * thread only, consumed through the profiling meter ports
+                 */
+                typedef struct profile_t
+                {
+                    uint64_t            nMin;           // Minimum stage time, ns
+                    uint64_t            nMax;           // Maximum stage time, ns
+                    uint64_t            nSum;           // Accumulated stage time, ns
+                    uint64_t            nCount;         // Number of aggregated blocks
+                } profile_t;
+            #endif /* LSP_SHAPER_PROFILING */
+
+                /**
+                 * Per-channel state, split into a hot leading section that the
+                 * per-chunk shaping path dereferences and a cold trailing
+                 * section touched only around block boundaries. Channels are
+                 * carved from the instance arena, so the hot section of the
+                 * first channel starts on a cache line boundary
+                 */
+                typedef struct channel_t
+                {
+                    // Hot: everything the shaping kernels read per chunk,
+                    // fits a single cache line
+                    const float        *vIn;                // Input buffer pointer
+                    float              *vOut;               // Output buffer pointer
+                    float              *vBuffer;            // Channel buffer at host sample rate
+                    float              *vOvsBuffer;         // Channel buffer at oversampled rate
+                    float              *vFadeBuffer;        // Channel scratch for the fading-out curve
+                    float              *vModeBuffer;        // Channel buffer for the oversampled path in auto mode
+                    float               fAdaaX1;            // Last input sample seen by the ADAA kernel
+                    float               fInLevel;           // Input level meter
+                    float               fOutLevel;          // Output level meter
+
+                    // DSP processing modules
+                    dspu::Bypass        sBypass;            // Bypass switch
+                    dspu::Oversampler   sOver;              // Oversampler
+                    dspu::Delay         sDelay;             // Aligns the 1x path with the oversampler latency in auto mode
+
+                    // Cold: ports, accessed at most once per block
+                    plug::IPort        *pIn;                // Input port
+                    plug::IPort        *pOut;               // Output port
+                    plug::IPort        *pInMeter;           // Input level meter port
+                    plug::IPort        *pOutMeter;          // Output level meter port
+                } channel_t;
+
+            protected:
+                size_t              nChannels;              // Number of channels
+                channel_t          *vChannels;              // Audio channels
+                float              *vBuffer;                // Temporary buffer at host sample rate
+                float              *vOvsBuffer;             // Buffer at oversampled rate
+                float              *vFadeBuffer;            // Buffer for the fading-out curve evaluation
+                float              *vModeBuffer;            // Buffer for the oversampled path in auto mode
+                double             *vMatrix;                // Matrix workspace for the curve fit
+                float              *vLinCoord;              // Linear graph: input values
+                float              *vLogCoord;              // Logarithmic graph: input values (dB), allocated lazily
+
+                snapshot_t          sSnapshot;              // Published parameter snapshot
+                uatomic_t           nSnapSeq;               // Snapshot sequence counter, odd while being written
+                uatomic_t           nSnapVersion;           // Snapshot generation, advanced on each publication
+                size_t              nSnapApplied;           // Snapshot generation last applied by the audio thread
+
+                CurveTask           sCurveTask;             // Background curve fit task
+                curve_params_t      sCurveParams;           // Parameter snapshot for the fit task
+                curve_t             vCurves[CURVES_TOTAL];  // Shared curve state buffers
+                curve_t            *pActiveCurve;           // Curve visible to the audio thread
+                curve_t            *pFadeCurve;             // Previous curve, faded out after a swap
+                curve_t            *pFitCurve;              // Curve being rendered by the fit task
+                size_t              nChunkSize;             // Internal processing chunk size, adapted to the oversampling ratio
+                size_t              nChunkOverride;         // Chunk size forced through the environment, 0 when unset
+                size_t              nFadeTotal;             // Curve crossfade length in samples
+                size_t              nFadePos;               // Current crossfade position
+                size_t              nSettleTotal;           // Quiet period before a refit is scheduled, samples
+                size_t              nSettleLeft;            // Samples left until pending changes are considered settled
+
+                size_t              nOrder;                 // Polynomial order
+                size_t              nCurveMode;             // Curve evaluation mode
+                size_t              nOversampling;          // Oversampling mode index
+                size_t              nOvsQuality;            // Oversampling quality mode
+                float               fGainIn;                // Input gain
+                float               fGainOut;               // Output gain
+                float               fHScale;                // Horizontal scale
+                float               fHShift;                // Horizontal shift
+                float               fVScale;                // Vertical scale
+                float               fVShift;                // Vertical shift
+                float               fHScaleB;               // Horizontal scale, morph endpoint B
+                float               fHShiftB;               // Horizontal shift, morph endpoint B
+                float               fVScaleB;               // Vertical scale, morph endpoint B
+                float               fVShiftB;               // Vertical shift, morph endpoint B
+                float               fMorph;                 // Morph position between the fitted endpoints
+                bool                bMorph;                 // Morph engaged: interpolated coefficients drive the kernels
+                bool                bAutoOvs;               // Automatic oversampling mode selected
+                bool                bAdaa;                  // Antiderivative antialiasing selected instead of oversampling
+                bool                bOvsActive;             // Oversampler currently engaged
+                size_t              nOvsFadePos;            // Crossfade position of an oversampler mode transition
+                size_t              nCurveVersion;          // Most recently installed curve generation
+                size_t              nMeshVersion;           // Curve generation last synchronized to the meshes
+                uatomic_t           nUIRefs;                // Attached UI counter: zero enables the offline fast path
+                bool                bListen;                // Monitor the shaping residue (wet minus dry)
+                bool                bDither;                // Inject anti-denormal DC into the processing path
+                bool                bCurveDirty;            // Curve parameters changed, refit is pending
+                bool                bPoolBound;             // Instance is registered with the shared worker pool
+
+                plug::IPort        *pBypass;                // Bypass port
+                plug::IPort        *pGainIn;                // Input gain port
+                plug::IPort        *pGainOut;               // Output gain port
+                plug::IPort        *pHScale;                // Horizontal scale port
+                plug::IPort        *pHShift;                // Horizontal shift port
+                plug::IPort        *pVScale;                // Vertical scale port
+                plug::IPort        *pVShift;                // Vertical shift port
+                plug::IPort        *pHScaleB;               // Horizontal scale port, morph endpoint B
+                plug::IPort        *pHShiftB;               // Horizontal shift port, morph endpoint B
+                plug::IPort        *pVScaleB;               // Vertical scale port, morph endpoint B
+                plug::IPort        *pVShiftB;               // Vertical shift port, morph endpoint B
+                plug::IPort        *pMorph;                 // Morph position port
+                plug::IPort        *pOrder;                 // Polynomial order port
+                plug::IPort        *pOversampling;          // Oversampling mode port
+                plug::IPort        *pOvsQuality;            // Oversampling quality port
+                plug::IPort        *pCurveMode;             // Curve evaluation mode port
+                plug::IPort        *pListen;                // Listen port
+                plug::IPort        *pDither;                // Anti-denormal dither port
+                plug::IPort        *pLinMesh;               // Linear graph mesh port
+                plug::IPort        *pLogMesh;               // Logarithmic graph mesh port
+
+                core::IDBuffer     *pIDisplay;              // Inline display buffer with the projected polyline
+                size_t              nIDisplayVersion;       // Curve generation projected into the buffer
+                size_t              nIDisplayWidth;         // Canvas width the polyline was projected for
+                size_t              nIDisplayHeight;        // Canvas height the polyline was projected for
+
+            #ifdef LSP_SHAPER_PROFILING
+                profile_t           sProfOvs;               // Resampling stage timing
+                profile_t           sProfCurve;             // Curve evaluation stage timing
+                profile_t           sProfSet;               // Settings update timing
+                plug::IPort        *pProfOvs;               // Resampling time meter port
+                plug::IPort        *pProfCurve;             // Curve evaluation time meter port
+                plug::IPort        *pProfSet;               // Settings update time meter port
+            #endif /* LSP_SHAPER_PROFILING */
+
+                uint8_t            *pData;                  // Allocated buffer data
+                uint8_t            *pGraphData;             // Lazily allocated log-scale graph data
+
+            protected:
+                static dspu::over_mode_t    decode_oversampling_mode(size_t mode, size_t quality);
+                static float        curve_target(const curve_params_t *p, float x);
+
+            #ifdef LSP_SHAPER_PROFILING
+                static uint64_t     prof_now();
+                static void         prof_commit(profile_t *p, uint64_t delta);
+                static void         prof_report(const profile_t *p, plug::IPort *port);
+            #endif /* LSP_SHAPER_PROFILING */
+
+            protected:
+                size_t              select_chunk_size() const;
+                bool                alloc_log_graphs();
+                void                produce_curve(curve_t *c, const curve_params_t *p);
+                void                fit_curve(curve_t *c, const curve_params_t *p);
+                void                fit_coeffs(float *coeffs, const curve_params_t *p);
+                bool                kvt_restore_curve(curve_t *c, const curve_params_t *p);
+                void                kvt_save_curve(const curve_t *c, const curve_params_t *p);
+                void                render_lut(curve_t *c);
+                void                render_adaa(curve_t *c);
+                void                render_graphs(curve_t *c);
+                status_t            fit_task();
+                bool                offline_render() const;
+                bool                fetch_snapshot(snapshot_t *dst);
+                void                commit_settings(const snapshot_t *s);
+                void                update_curve_state();
+                void                update_morph(curve_t *c);
+                void                apply_curve(const curve_t *c, float *dst, const float *src, float gain, size_t count);
+                void                apply_curve_x2(const curve_t *c, float *dst_l, float *dst_r, const float *src_l, const float *src_r, float gain, size_t count);
+                void                shape_chunk(channel_t *ch, float *dst, const float *src, float gain, size_t count, float fade_t0, float fade_dt);
+                void                shape_chunk_x2(channel_t *l, channel_t *r, float *dst_l, float *dst_r, const float *src_l, const float *src_r, float gain, size_t count, float fade_t0, float fade_dt);
+                void                shape_chunk_adaa(channel_t *ch, float *dst, const float *src, float gain, size_t count, float fade_t0, float fade_dt);
+                void                sync_meshes();
+                void                do_destroy();
+
+            public:
+                explicit shaper(const meta::plugin_t *meta);
+                shaper(const shaper &) = delete;
+                shaper(shaper &&) = delete;
+                virtual ~shaper() override;
+
+                shaper & operator = (const shaper &) = delete;
+                shaper & operator = (shaper &&) = delete;
+
+                virtual void        init(plug::IWrapper *wrapper, plug::IPort **ports) override;
+                virtual void        destroy() override;
+
+            public:
+                virtual void        update_sample_rate(long sr) override;
+                virtual void        update_settings() override;
+                virtual void        process(size_t samples) override;
+                virtual bool        inline_display(plug::ICanvas *cv, size_t width, size_t height) override;
+                virtual void        ui_activated() override;
+                virtual void        ui_deactivated() override;
+                virtual void        dump(dspu::IStateDumper *v) const override;
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_SHAPER_H_ */
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#include <private/dsp/curve_cache.h>
+#include <private/meta/shaper.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        namespace curve
+        {
+            //-----------------------------------------------------------------
+            // Cache internals: a small fixed-size table scanned linearly under
+            // a spinlock. All callers are worker threads, so the short
+            // critical section never blocks the audio path; entries with a
+            // zero reference count remain cached and are recycled when a new
+            // key needs a slot.
+            static constexpr size_t CACHE_CAPACITY  = 64;
+
+            /**
+             * Fit parameters quantized to the port step, the cache key
+             */
+            typedef struct key_t
+            {
+                int32_t         nHScale;
+                int32_t         nHShift;
+                int32_t         nVScale;
+                int32_t         nVShift;
+                uint32_t        nOrder;
+            } key_t;
+
+            typedef struct entry_t
+            {
+                shared_t        sShared;        // Data visible to the instances, must stay the first field
+                key_t           sKey;           // Quantized fit parameters
+                size_t          nRefs;          // Instances referencing the entry
+                bool            bUsed;          // Slot holds a valid curve
+                float           vCoeffs[meta::shaper::ORDER_MAX + 1];
+                float          *vLut;           // Lazily allocated lookup table
+            } entry_t;
+
+            static entry_t      vCache[CACHE_CAPACITY];
+            static uatomic_t    nCacheLock      = 0;
+
+            static inline int32_t quantize(float v)
+            {
+                // Port values move in steps of 0.001, see the meta definition
+                return int32_t(roundf(v * 1000.0f));
+            }
+
+            static inline void make_key(key_t *key, float hscale, float hshift, float vscale, float vshift, size_t order)
+            {
+                key->nHScale        = quantize(hscale);
+                key->nHShift        = quantize(hshift);
+                key->nVScale        = quantize(vscale);
+                key->nVShift        = quantize(vshift);
+                key->nOrder         = uint32_t(order);
+            }
+
+            static inline bool key_matches(const key_t *a, const key_t *b)
+            {
+                return
+                    (a->nHScale == b->nHScale) &&
+                    (a->nHShift == b->nHShift) &&
+                    (a->nVScale == b->nVScale) &&
+                    (a->nVShift == b->nVShift) &&
+                    (a->nOrder == b->nOrder);
+            }
+
+            static inline void cache_lock()
+            {
+                while (!atomic_cas(&nCacheLock, 0, 1))
+                    /* Spin: the critical section is a short table scan */ ;
+            }
+
+            static inline void cache_unlock()
+            {
+                atomic_swap(&nCacheLock, 0);
+            }
+
+            static entry_t *find_entry(const key_t *key)
+            {
+                for (size_t i=0; i<CACHE_CAPACITY; ++i)
+                {
+                    entry_t *e          = &vCache[i];
+                    if ((e->bUsed) && (key_matches(&e->sKey, key)))
+                        return e;
+                }
+                return NULL;
+            }
+
+            //-----------------------------------------------------------------
+            // Public interface
+            shared_t *cache_acquire(float hscale, float hshift, float vscale, float vshift, size_t order)
+            {
+                key_t key;
+                make_key(&key, hscale, hshift, vscale, vshift, order);
+
+                cache_lock();
+                entry_t *e          = find_entry(&key);
+                if (e != NULL)
+                    ++e->nRefs;
+                cache_unlock();
+
+                return (e != NULL) ? &e->sShared : NULL;
+            }
+
+            shared_t *cache_commit(float hscale, float hshift, float vscale, float vshift, size_t order,
+                const float *coeffs, const float *lut, size_t lut_size)
+            {
+                key_t key;
+                make_key(&key, hscale, hshift, vscale, vshift, order);
+
+                // The lookup table is copied into heap storage outside of the
+                // critical section; ownership passes to the entry on success
+                float *lut_copy     = NULL;
+                if (lut != NULL)
+                {
+                    lut_copy            = new float[lut_size];
+                    if (lut_copy != NULL)
+                        dsp::copy(lut_copy, lut, lut_size);
+                }
+
+                cache_lock();
+
+                // Lost the race against another instance fitting the same key?
+                entry_t *e          = find_entry(&key);
+                if (e != NULL)
+                    ++e->nRefs;
+                else
+                {
+                    // Claim a free slot, or recycle an unreferenced one
+                    for (size_t i=0; i<CACHE_CAPACITY; ++i)
+                    {
+                        entry_t *c          = &vCache[i];
+                        if (!c->bUsed)
+                        {
+                            e                   = c;
+                            break;
+                        }
+                        if ((c->nRefs == 0) && (e == NULL))
+                            e                   = c;
+                    }
+
+                    if (e != NULL)
+                    {
+                        if (e->vLut != NULL)
+                        {
+                            delete [] e->vLut;
+                            e->vLut             = NULL;
+                        }
+
+                        dsp::fill_zero(e->vCoeffs, meta::shaper::ORDER_MAX + 1);
+                        dsp::copy(e->vCoeffs, coeffs, order + 1);
+                        e->sKey             = key;
+                        e->nRefs            = 1;
+                        e->bUsed            = true;
+                        e->vLut             = lut_copy;
+                        lut_copy            = NULL;
+
+                        e->sShared.vCoeffs  = e->vCoeffs;
+                        e->sShared.nOrder   = order;
+                        e->sShared.vLut     = e->vLut;
+                        e->sShared.nLutSize = (e->vLut != NULL) ? lut_size : 0;
+                    }
+                }
+
+                cache_unlock();
+
+                if (lut_copy != NULL)
+                    delete [] lut_copy;
+
+                return (e != NULL) ? &e->sShared : NULL;
+            }
+
+            void cache_attach_lut(shared_t *s, const float *lut, size_t lut_size)
+            {
+                if ((s == NULL) || (lut == NULL))
+                    return;
+
+                float *lut_copy     = new float[lut_size];
+                if (lut_copy == NULL)
+                    return;
+                dsp::copy(lut_copy, lut, lut_size);
+
+                entry_t *e          = reinterpret_cast<entry_t *>(s);
+
+                cache_lock();
+                if (e->vLut == NULL)
+                {
+                    e->vLut             = lut_copy;
+                    e->sShared.vLut     = e->vLut;
+                    e->sShared.nLutSize = lut_size;
+                    lut_copy            = NULL;
+                }
+                cache_unlock();
+
+                if (lut_copy != NULL)
+                    delete [] lut_copy;
+            }
+
+            void cache_release(shared_t *s)
+            {
+                if (s == NULL)
+                    return;
+                entry_t *e          = reinterpret_cast<entry_t *>(s);
+
+                cache_lock();
+                if (e->nRefs > 0)
+                    --e->nRefs;
+                cache_unlock();
+            }
+
+        } /* namespace curve */
+    } /* namespace plugins */
+} /* namespace lsp */
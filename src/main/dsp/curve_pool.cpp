@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/ipc/IExecutor.h>
+#include <lsp-plug.in/ipc/Mutex.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+
+#include <private/dsp/curve_pool.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        namespace curve
+        {
+            //-----------------------------------------------------------------
+            // Pool internals: two fixed-capacity FIFO rings (urgent and
+            // relaxed) guarded by a spinlock, drained by a small set of
+            // worker threads. Every instance owns exactly one task object and
+            // submits it only when idle, so the queue depth is bounded by the
+            // instance count; a full ring makes the submission fail and the
+            // caller falls back to its wrapper executor. A single shared
+            // queue also makes priorities trivial: workers always drain the
+            // urgent ring first.
+            static constexpr size_t     POOL_QUEUE_CAPACITY = 256;  // Power of two, at least the expected instance count
+            static constexpr size_t     POOL_WORKERS_MAX    = 16;
+            static constexpr ssize_t    POOL_RESERVED_CORES = 2;    // Cores left to the host audio threads
+            static constexpr size_t     POOL_IDLE_SLEEP     = 2;    // Worker poll period when idle, ms
+
+            typedef struct queue_t
+            {
+                ipc::ITask     *vTasks[POOL_QUEUE_CAPACITY];
+                size_t          nHead;          // Index of the oldest task
+                size_t          nCount;         // Number of queued tasks
+            } queue_t;
+
+            /**
+             * The executor subclass exists to reach the protected ITask state
+             * helpers; tasks executed by the pool keep the exact idle ->
+             * submitted -> running -> completed lifecycle the wrapper
+             * executors provide, so the plugin code polls them identically.
+             */
+            class PoolExecutor: public ipc::IExecutor
+            {
+                public:
+                    virtual bool    submit(ipc::ITask *task) override;
+
+                public:
+                    bool            enqueue(ipc::ITask *task, bool urgent);
+                    void            cancel(ipc::ITask *task);
+                    bool            process();
+                    void            drain();
+            };
+
+            static queue_t      sUrgent;        // Instances currently producing sound
+            static queue_t      sRelaxed;       // Bypassed instances
+            static uatomic_t    nQueueLock      = 0;
+            static PoolExecutor sExecutor;
+
+            static ipc::Mutex   sPoolLock;      // Serializes bind/unbind
+            static size_t       nPoolRefs      = 0;
+            static ipc::Thread *vWorkers[POOL_WORKERS_MAX];
+            static size_t       nWorkers       = 0;
+
+            static inline void queue_lock()
+            {
+                while (!atomic_cas(&nQueueLock, 0, 1))
+                    /* Spin: the critical section is a few pointer moves */ ;
+            }
+
+            static inline void queue_unlock()
+            {
+                atomic_swap(&nQueueLock, 0);
+            }
+
+            static bool queue_push(queue_t *q, ipc::ITask *task)
+            {
+                if (q->nCount >= POOL_QUEUE_CAPACITY)
+                    return false;
+                q->vTasks[(q->nHead + q->nCount) & (POOL_QUEUE_CAPACITY - 1)] = task;
+                ++q->nCount;
+                return true;
+            }
+
+            static ipc::ITask *queue_pop(queue_t *q)
+            {
+                if (q->nCount == 0)
+                    return NULL;
+                ipc::ITask *task    = q->vTasks[q->nHead];
+                q->nHead            = (q->nHead + 1) & (POOL_QUEUE_CAPACITY - 1);
+                --q->nCount;
+                return task;
+            }
+
+            static bool queue_remove(queue_t *q, ipc::ITask *task)
+            {
+                for (size_t i=0; i<q->nCount; ++i)
+                {
+                    const size_t idx    = (q->nHead + i) & (POOL_QUEUE_CAPACITY - 1);
+                    if (q->vTasks[idx] != task)
+                        continue;
+
+                    // Close the gap, preserving submission order
+                    for (size_t j=i+1; j<q->nCount; ++j)
+                    {
+                        const size_t src    = (q->nHead + j) & (POOL_QUEUE_CAPACITY - 1);
+                        const size_t dst    = (q->nHead + j - 1) & (POOL_QUEUE_CAPACITY - 1);
+                        q->vTasks[dst]      = q->vTasks[src];
+                    }
+                    --q->nCount;
+                    return true;
+                }
+                return false;
+            }
+
+            //-----------------------------------------------------------------
+            // Executor implementation
+            bool PoolExecutor::submit(ipc::ITask *task)
+            {
+                return enqueue(task, false);
+            }
+
+            bool PoolExecutor::enqueue(ipc::ITask *task, bool urgent)
+            {
+                if (!task->idle())
+                    return false;
+
+                queue_lock();
+                const bool queued   = (nWorkers > 0) &&
+                    queue_push((urgent) ? &sUrgent : &sRelaxed, task);
+                if (queued)
+                    change_task_state(task, ipc::ITask::TS_SUBMITTED);
+                queue_unlock();
+
+                return queued;
+            }
+
+            void PoolExecutor::cancel(ipc::ITask *task)
+            {
+                // A queued task is unlinked and reset; one that a worker has
+                // already fetched is past unlinking, wait for it to finish.
+                // Fetching moves the task to the running state under the
+                // queue lock, so after a failed unlink the task is either
+                // running or already done; still, the wait covers the full
+                // not-idle-and-not-completed range rather than just running,
+                // so a task that somehow stayed submitted can not slip
+                // through and execute against a destroyed owner
+                queue_lock();
+                const bool removed  =
+                    queue_remove(&sUrgent, task) ||
+                    queue_remove(&sRelaxed, task);
+                if (removed)
+                    change_task_state(task, ipc::ITask::TS_IDLE);
+                queue_unlock();
+
+                if (!removed)
+                {
+                    while ((!task->idle()) && (!task->completed()))
+                        ipc::Thread::sleep(1);
+                }
+            }
+
+            bool PoolExecutor::process()
+            {
+                // The fetched task enters the running state while the queue
+                // lock is still held: a concurrent cancel() thus always sees
+                // it either in a queue or running, never in the submitted
+                // limbo between the pop and the actual execution
+                queue_lock();
+                ipc::ITask *task    = queue_pop(&sUrgent);
+                if (task == NULL)
+                    task                = queue_pop(&sRelaxed);
+                if (task != NULL)
+                    change_task_state(task, ipc::ITask::TS_RUNNING);
+                queue_unlock();
+
+                if (task == NULL)
+                    return false;
+
+                run_task(task);
+                return true;
+            }
+
+            void PoolExecutor::drain()
+            {
+                // Called with no workers left: return queued tasks to idle so
+                // their owners see a consistent state
+                queue_lock();
+                ipc::ITask *task;
+                while ((task = queue_pop(&sUrgent)) != NULL)
+                    change_task_state(task, ipc::ITask::TS_IDLE);
+                while ((task = queue_pop(&sRelaxed)) != NULL)
+                    change_task_state(task, ipc::ITask::TS_IDLE);
+                queue_unlock();
+            }
+
+            //-----------------------------------------------------------------
+            // Worker lifecycle
+            static status_t pool_worker(void *arg)
+            {
+                while (!ipc::Thread::is_cancelled())
+                {
+                    if (!sExecutor.process())
+                        ipc::Thread::sleep(POOL_IDLE_SLEEP);
+                }
+                return STATUS_OK;
+            }
+
+            static size_t pool_size()
+            {
+                // An explicit environment override wins over the heuristic;
+                // zero disables the pool
+                const char *env     = getenv("LSP_SHAPER_POOL_SIZE");
+                if (env != NULL)
+                {
+                    const long value    = strtol(env, NULL, 10);
+                    if (value >= 0)
+                        return lsp_min(size_t(value), POOL_WORKERS_MAX);
+                }
+
+                const ssize_t cores = ipc::Thread::system_cores();
+                return lsp_limit(cores - POOL_RESERVED_CORES, ssize_t(1), ssize_t(POOL_WORKERS_MAX));
+            }
+
+            //-----------------------------------------------------------------
+            // Public interface
+            bool pool_bind()
+            {
+                sPoolLock.lock();
+                lsp_finally { sPoolLock.unlock(); };
+
+                if (nPoolRefs++ > 0)
+                    return nWorkers > 0;
+
+                // First instance in the process: start the workers. The
+                // worker count is published under the queue lock so enqueue
+                // never accepts a task no thread would ever pick up.
+                const size_t count  = pool_size();
+                size_t started      = 0;
+                for (size_t i=0; i<count; ++i)
+                {
+                    ipc::Thread *t      = new ipc::Thread(pool_worker, NULL);
+                    if (t == NULL)
+                        break;
+                    if (t->start() != STATUS_OK)
+                    {
+                        delete t;
+                        break;
+                    }
+                    vWorkers[started++] = t;
+                }
+
+                queue_lock();
+                nWorkers            = started;
+                queue_unlock();
+
+                lsp_trace("curve pool: started %d of %d workers", int(started), int(count));
+                return started > 0;
+            }
+
+            void pool_unbind()
+            {
+                sPoolLock.lock();
+                lsp_finally { sPoolLock.unlock(); };
+
+                if ((nPoolRefs == 0) || (--nPoolRefs > 0))
+                    return;
+
+                // Last instance gone: stop accepting work, then stop the
+                // threads. Workers finish their current task before joining.
+                queue_lock();
+                const size_t count  = nWorkers;
+                nWorkers            = 0;
+                queue_unlock();
+
+                for (size_t i=0; i<count; ++i)
+                    vWorkers[i]->cancel();
+                for (size_t i=0; i<count; ++i)
+                {
+                    vWorkers[i]->join();
+                    delete vWorkers[i];
+                    vWorkers[i]         = NULL;
+                }
+
+                sExecutor.drain();
+            }
+
+            bool pool_submit(ipc::ITask *task, bool urgent)
+            {
+                return sExecutor.enqueue(task, urgent);
+            }
+
+            void pool_cancel(ipc::ITask *task)
+            {
+                sExecutor.cancel(task);
+            }
+
+        } /* namespace curve */
+    } /* namespace plugins */
+} /* namespace lsp */
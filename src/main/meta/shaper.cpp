@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/plug-fw/meta/ports.h>
+#include <lsp-plug.in/shared/meta/developers.h>
+
+#include <private/meta/shaper.h>
+
+#define LSP_PLUGINS_SHAPER_VERSION_MAJOR            1
+#define LSP_PLUGINS_SHAPER_VERSION_MINOR            0
+#define LSP_PLUGINS_SHAPER_VERSION_MICRO            0
+
+#define LSP_PLUGINS_SHAPER_VERSION  \
+    LSP_MODULE_VERSION( \
+        LSP_PLUGINS_SHAPER_VERSION_MAJOR, \
+        LSP_PLUGINS_SHAPER_VERSION_MINOR, \
+        LSP_PLUGINS_SHAPER_VERSION_MICRO  \
+    )
+
+namespace lsp
+{
+    namespace meta
+    {
+        //-------------------------------------------------------------------------
+        // Plugin metadata
+
+        static const port_item_t shaper_oversampling_mode[] =
+        {
+            { "None",           "shaper.oversampling.none"      },
+            { "2x",             "shaper.oversampling.2x"        },
+            { "3x",             "shaper.oversampling.3x"        },
+            { "4x",             "shaper.oversampling.4x"        },
+            { "6x",             "shaper.oversampling.6x"        },
+            { "8x",             "shaper.oversampling.8x"        },
+            { "Auto (8x)",      "shaper.oversampling.auto"      },
+            { "ADAA",           "shaper.oversampling.adaa"      },
+            { NULL, NULL }
+        };
+
+        static const port_item_t shaper_ovs_quality[] =
+        {
+            { "Normal",         "shaper.ovs_quality.normal"     },
+            { "Low latency",    "shaper.ovs_quality.low_latency" },
+            { NULL, NULL }
+        };
+
+        static const port_item_t shaper_curve_mode[] =
+        {
+            { "Polynomial",     "shaper.curve.polynomial"       },
+            { "Lookup table",   "shaper.curve.lut"              },
+            { NULL, NULL }
+        };
+
+        // Optional instrumentation: average per-stage processing time in
+        // microseconds, aggregated on the audio thread and published as meters
+        #ifdef LSP_SHAPER_PROFILING
+            #define SHAPER_PROFILING \
+                , METER("prof_ovs", "Profiling: resampling time", U_NONE, shaper::PROFILE) \
+                , METER("prof_curve", "Profiling: curve evaluation time", U_NONE, shaper::PROFILE) \
+                , METER("prof_set", "Profiling: settings update time", U_NONE, shaper::PROFILE)
+        #else
+            #define SHAPER_PROFILING
+        #endif /* LSP_SHAPER_PROFILING */
+
+        #define SHAPER_COMMON \
+            BYPASS, \
+            AMP_GAIN("g_in", "Input gain", "Input gain", shaper::IN_GAIN_DFL, shaper::IN_GAIN_MAX), \
+            AMP_GAIN("g_out", "Output gain", "Output gain", shaper::OUT_GAIN_DFL, shaper::OUT_GAIN_MAX), \
+            CONTROL("hscale", "Horizontal scale", "HScale", U_NONE, shaper::HSCALE), \
+            CONTROL("hshift", "Horizontal shift", "HShift", U_NONE, shaper::HSHIFT), \
+            CONTROL("vscale", "Vertical scale", "VScale", U_NONE, shaper::VSCALE), \
+            CONTROL("vshift", "Vertical shift", "VShift", U_NONE, shaper::VSHIFT), \
+            CONTROL("hscale_b", "Horizontal scale B", "HScale B", U_NONE, shaper::HSCALE), \
+            CONTROL("hshift_b", "Horizontal shift B", "HShift B", U_NONE, shaper::HSHIFT), \
+            CONTROL("vscale_b", "Vertical scale B", "VScale B", U_NONE, shaper::VSCALE), \
+            CONTROL("vshift_b", "Vertical shift B", "VShift B", U_NONE, shaper::VSHIFT), \
+            CONTROL("morph", "Morph between curves A and B", "Morph", U_NONE, shaper::MORPH), \
+            INT_CONTROL("order", "Polynomial order", "Order", U_NONE, shaper::ORDER), \
+            COMBO("ovs", "Oversampling", "Oversampling", shaper::OVERSAMPLING_DFL, shaper_oversampling_mode), \
+            COMBO("ovsq", "Oversampling quality", "Ovs quality", shaper::OVS_QUALITY_DFL, shaper_ovs_quality), \
+            COMBO("cmode", "Curve evaluation mode", "Curve mode", shaper::CURVE_MODE_DFL, shaper_curve_mode), \
+            SWITCH("listen", "Listen to the shaping residue", "Listen", 0.0f), \
+            SWITCH("dither", "Anti-denormal dither", "Dither", 0.0f), \
+            MESH("ling", "Linear graph", 2, shaper::GRAPH_DOTS), \
+            MESH("logg", "Logarithmic graph", 2, shaper::GRAPH_DOTS) \
+            SHAPER_PROFILING
+
+        static const port_t shaper_mono_ports[] =
+        {
+            PORTS_MONO_PLUGIN,
+            SHAPER_COMMON,
+            METER_GAIN("min", "Input level meter", GAIN_AMP_P_36_DB),
+            METER_GAIN("mout", "Output level meter", GAIN_AMP_P_36_DB),
+
+            PORTS_END
+        };
+
+        static const port_t shaper_stereo_ports[] =
+        {
+            PORTS_STEREO_PLUGIN,
+            SHAPER_COMMON,
+            METER_GAIN("min_l", "Input level meter Left", GAIN_AMP_P_36_DB),
+            METER_GAIN("mout_l", "Output level meter Left", GAIN_AMP_P_36_DB),
+            METER_GAIN("min_r", "Input level meter Right", GAIN_AMP_P_36_DB),
+            METER_GAIN("mout_r", "Output level meter Right", GAIN_AMP_P_36_DB),
+
+            PORTS_END
+        };
+
+        static const int plugin_classes[]           = { C_WAVESHAPER, -1 };
+        static const int clap_features_mono[]       = { CF_AUDIO_EFFECT, CF_DISTORTION, CF_MONO, -1 };
+        static const int clap_features_stereo[]     = { CF_AUDIO_EFFECT, CF_DISTORTION, CF_STEREO, -1 };
+
+        const meta::bundle_t shaper_bundle =
+        {
+            "shaper",
+            "Shaper",
+            B_EFFECTS,
+            "",
+            "Shaping of the audio signal using polynomial approximation of the parametrized sigmoid transfer function"
+        };
+
+        const plugin_t shaper_mono =
+        {
+            "Shaper Mono",
+            "Shaper Mono",
+            "Shaper Mono",
+            "SH1M",
+            &developers::v_sadovnikov,
+            "shaper_mono",
+            {
+                LSP_LV2_URI("shaper_mono"),
+                LSP_LV2UI_URI("shaper_mono"),
+                "sh1m",
+                LSP_VST3_UID("sh1m    shaper_mono"),
+                LSP_VST3UI_UID("sh1m    shaper_mono"),
+                0,
+                NULL,
+                LSP_CLAP_URI("shaper_mono"),
+                LSP_GST_UID("shaper_mono"),
+            },
+            LSP_PLUGINS_SHAPER_VERSION,
+            plugin_classes,
+            clap_features_mono,
+            E_DUMP_STATE | E_INLINE_DISPLAY,
+            shaper_mono_ports,
+            "effects/shaper.xml",
+            NULL,
+            mono_plugin_port_groups,
+            &shaper_bundle
+        };
+
+        const plugin_t shaper_stereo =
+        {
+            "Shaper Stereo",
+            "Shaper Stereo",
+            "Shaper Stereo",
+            "SH1S",
+            &developers::v_sadovnikov,
+            "shaper_stereo",
+            {
+                LSP_LV2_URI("shaper_stereo"),
+                LSP_LV2UI_URI("shaper_stereo"),
+                "sh1s",
+                LSP_VST3_UID("sh1s    shaper_stereo"),
+                LSP_VST3UI_UID("sh1s    shaper_stereo"),
+                0,
+                NULL,
+                LSP_CLAP_URI("shaper_stereo"),
+                LSP_GST_UID("shaper_stereo"),
+            },
+            LSP_PLUGINS_SHAPER_VERSION,
+            plugin_classes,
+            clap_features_stereo,
+            E_DUMP_STATE | E_INLINE_DISPLAY,
+            shaper_stereo_ports,
+            "effects/shaper.xml",
+            NULL,
+            stereo_plugin_port_groups,
+            &shaper_bundle
+        };
+
+    } /* namespace meta */
+} /* namespace lsp */
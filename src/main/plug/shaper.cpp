@@ -0,0 +1,1719 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 25 May 2025
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/ipc/IExecutor.h>
+#include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
+#include <lsp-plug.in/plug-fw/core/IDBuffer.h>
+#include <lsp-plug.in/plug-fw/core/KVTStorage.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+
+#include <private/dsp/curve.h>
+#include <private/dsp/curve_cache.h>
+#include <private/dsp/curve_pool.h>
+#include <private/meta/shaper.h>
+#include <private/plugins/shaper.h>
+
+#ifdef LSP_SHAPER_PROFILING
+    #include <time.h>
+#endif /* LSP_SHAPER_PROFILING */
+
+namespace lsp
+{
+    namespace plugins
+    {
+        //---------------------------------------------------------------------
+        // Plugin factory
+        static const meta::plugin_t *plugins[] =
+        {
+            &meta::shaper_mono,
+            &meta::shaper_stereo
+        };
+
+        static plug::Module *plugin_factory(const meta::plugin_t *meta)
+        {
+            return new shaper(meta);
+        }
+
+        static plug::Factory factory(plugin_factory, plugins, 2);
+
+        //---------------------------------------------------------------------
+        // Fitted curve state persisted with the session through the KVT
+        // storage: restoring a session installs the exact coefficients without
+        // re-running the matrix solve, see kvt_restore_curve
+        static constexpr char       CURVE_KVT_PATH[]    = "/curve";
+        static constexpr char       CURVE_KVT_CTYPE[]   = "application/x-lsp-shaper-curve";
+        static constexpr uint32_t   CURVE_BLOB_MAGIC    = 0x53485043;   // 'SHPC'
+        static constexpr uint32_t   CURVE_BLOB_VERSION  = 1;
+
+        typedef struct curve_blob_t
+        {
+            uint32_t        nMagic;         // CURVE_BLOB_MAGIC
+            uint32_t        nVersion;       // CURVE_BLOB_VERSION
+            float           fHScale;        // Fit parameters the coefficients were produced for
+            float           fHShift;
+            float           fVScale;
+            float           fVShift;
+            uint32_t        nOrder;         // Polynomial order
+            float           vCoeffs[meta::shaper::ORDER_MAX + 1];
+        } curve_blob_t;
+
+    #ifdef LSP_SHAPER_PROFILING
+        //---------------------------------------------------------------------
+        // Profiling helpers
+        uint64_t shaper::prof_now()
+        {
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+            return uint64_t(ts.tv_sec) * 1000000000ULL + uint64_t(ts.tv_nsec);
+        }
+
+        void shaper::prof_commit(profile_t *p, uint64_t delta)
+        {
+            if ((p->nCount == 0) || (delta < p->nMin))
+                p->nMin             = delta;
+            if (delta > p->nMax)
+                p->nMax             = delta;
+            p->nSum            += delta;
+            ++p->nCount;
+        }
+
+        void shaper::prof_report(const profile_t *p, plug::IPort *port)
+        {
+            // Report the running average stage time in microseconds
+            if ((port == NULL) || (p->nCount == 0))
+                return;
+            port->set_value((p->nSum * 1e-3) / p->nCount);
+        }
+    #endif /* LSP_SHAPER_PROFILING */
+
+        //---------------------------------------------------------------------
+        // Background curve fit task
+        shaper::CurveTask::CurveTask(shaper *core)
+        {
+            pCore               = core;
+        }
+
+        status_t shaper::CurveTask::run()
+        {
+            return pCore->fit_task();
+        }
+
+        //---------------------------------------------------------------------
+        // Implementation
+        shaper::shaper(const meta::plugin_t *meta):
+            Module(meta),
+            sCurveTask(this)
+        {
+            nChannels           = 1;
+            if (!strcmp(meta->uid, meta::shaper_stereo.uid))
+                nChannels           = 2;
+
+            vChannels           = NULL;
+            vBuffer             = NULL;
+            vOvsBuffer          = NULL;
+            vFadeBuffer         = NULL;
+            vModeBuffer         = NULL;
+            vMatrix             = NULL;
+            vLinCoord           = NULL;
+            vLogCoord           = NULL;
+
+            sSnapshot.fGainIn       = GAIN_AMP_0_DB;
+            sSnapshot.fGainOut      = GAIN_AMP_0_DB;
+            sSnapshot.fHScale       = meta::shaper::HSCALE_DFL;
+            sSnapshot.fHShift       = meta::shaper::HSHIFT_DFL;
+            sSnapshot.fVScale       = meta::shaper::VSCALE_DFL;
+            sSnapshot.fVShift       = meta::shaper::VSHIFT_DFL;
+            sSnapshot.fHScaleB      = meta::shaper::HSCALE_DFL;
+            sSnapshot.fHShiftB      = meta::shaper::HSHIFT_DFL;
+            sSnapshot.fVScaleB      = meta::shaper::VSCALE_DFL;
+            sSnapshot.fVShiftB      = meta::shaper::VSHIFT_DFL;
+            sSnapshot.fMorph        = meta::shaper::MORPH_DFL;
+            sSnapshot.nOrder        = meta::shaper::ORDER_DFL;
+            sSnapshot.nCurveMode    = CM_POLY;
+            sSnapshot.nOversampling = meta::shaper::OVERSAMPLING_DFL;
+            sSnapshot.nOvsQuality   = meta::shaper::OVS_QUALITY_DFL;
+            sSnapshot.nFlags        = 0;
+            nSnapSeq                = 0;
+            nSnapVersion            = 0;
+            nSnapApplied            = 0;
+
+            sCurveParams.fHScale    = meta::shaper::HSCALE_DFL;
+            sCurveParams.fHShift    = meta::shaper::HSHIFT_DFL;
+            sCurveParams.fVScale    = meta::shaper::VSCALE_DFL;
+            sCurveParams.fVShift    = meta::shaper::VSHIFT_DFL;
+            sCurveParams.fHScaleB   = meta::shaper::HSCALE_DFL;
+            sCurveParams.fHShiftB   = meta::shaper::HSHIFT_DFL;
+            sCurveParams.fVScaleB   = meta::shaper::VSCALE_DFL;
+            sCurveParams.fVShiftB   = meta::shaper::VSHIFT_DFL;
+            sCurveParams.nOrder     = meta::shaper::ORDER_DFL;
+            sCurveParams.nMode      = CM_POLY;
+
+            for (size_t i=0; i<CURVES_TOTAL; ++i)
+                vCurves[i].pShared  = NULL;
+
+            pActiveCurve        = NULL;
+            pFadeCurve          = NULL;
+            pFitCurve           = NULL;
+
+            // The internal chunk size may be forced through the environment
+            // for benchmarking and for hosts with unusual cache topologies
+            nChunkSize          = CHUNK_SIZE_MIN;
+            nChunkOverride      = 0;
+            const char *chunk_env   = getenv("LSP_SHAPER_CHUNK_SIZE");
+            if (chunk_env != NULL)
+            {
+                const long value    = strtol(chunk_env, NULL, 10);
+                if (value > 0)
+                    nChunkOverride      = lsp_limit(size_t(value), size_t(CHUNK_SIZE_MIN), size_t(CHUNK_SIZE_MAX));
+            }
+
+            nFadeTotal          = 0;
+            nFadePos            = 0;
+            nSettleTotal        = 0;
+            nSettleLeft         = 0;
+
+            nOrder              = meta::shaper::ORDER_DFL;
+            nCurveMode          = CM_POLY;
+            nOversampling       = meta::shaper::OVERSAMPLING_DFL;
+            nOvsQuality         = meta::shaper::OVS_QUALITY_DFL;
+            fGainIn             = GAIN_AMP_0_DB;
+            fGainOut            = GAIN_AMP_0_DB;
+            fHScale             = meta::shaper::HSCALE_DFL;
+            fHShift             = meta::shaper::HSHIFT_DFL;
+            fVScale             = meta::shaper::VSCALE_DFL;
+            fVShift             = meta::shaper::VSHIFT_DFL;
+            fHScaleB            = meta::shaper::HSCALE_DFL;
+            fHShiftB            = meta::shaper::HSHIFT_DFL;
+            fVScaleB            = meta::shaper::VSCALE_DFL;
+            fVShiftB            = meta::shaper::VSHIFT_DFL;
+            fMorph              = meta::shaper::MORPH_DFL;
+            bMorph              = false;
+            bAutoOvs            = false;
+            bAdaa               = false;
+            bOvsActive          = false;
+            nOvsFadePos         = 0;
+            nCurveVersion       = 0;
+            nMeshVersion        = 0;
+            nUIRefs             = 0;
+            bListen             = false;
+            bDither             = false;
+            bCurveDirty         = true;
+            bPoolBound          = false;
+
+            pBypass             = NULL;
+            pGainIn             = NULL;
+            pGainOut            = NULL;
+            pHScale             = NULL;
+            pHShift             = NULL;
+            pVScale             = NULL;
+            pVShift             = NULL;
+            pHScaleB            = NULL;
+            pHShiftB            = NULL;
+            pVScaleB            = NULL;
+            pVShiftB            = NULL;
+            pMorph              = NULL;
+            pOrder              = NULL;
+            pOversampling       = NULL;
+            pOvsQuality         = NULL;
+            pCurveMode          = NULL;
+            pListen             = NULL;
+            pDither             = NULL;
+            pLinMesh            = NULL;
+            pLogMesh            = NULL;
+
+            pIDisplay           = NULL;
+            nIDisplayVersion    = 0;
+            nIDisplayWidth      = 0;
+            nIDisplayHeight     = 0;
+
+        #ifdef LSP_SHAPER_PROFILING
+            sProfOvs            = profile_t();
+            sProfCurve          = profile_t();
+            sProfSet            = profile_t();
+            pProfOvs            = NULL;
+            pProfCurve          = NULL;
+            pProfSet            = NULL;
+        #endif /* LSP_SHAPER_PROFILING */
+
+            pData               = NULL;
+            pGraphData          = NULL;
+        }
+
+        shaper::~shaper()
+        {
+            do_destroy();
+        }
+
+        void shaper::init(plug::IWrapper *wrapper, plug::IPort **ports)
+        {
+            // Pass wrapper
+            plug::Module::init(wrapper, ports);
+
+            // Resolve curve evaluation kernels
+            curve::init();
+
+            // Join the process-wide worker pool that bounds background
+            // fitting CPU across all instances in the session
+            bPoolBound          = curve::pool_bind();
+
+            // Carve all per-instance state out of one 64-byte-aligned arena,
+            // laid out in processing order: the channel structures with their
+            // hot leading sections first, then the audio buffers, then the
+            // curve state, then the cold fit workspace and graph abscissas
+            // channels:    channel_t structures, hot fields at the head
+            // per channel: vBuffer, vModeBuffer - CHUNK_SIZE_MAX floats
+            //              vOvsBuffer, vFadeBuffer - CHUNK_SIZE_MAX * OVERSAMPLING_MAX floats
+            // per curve:   LUT + linear graph (log-scale data is lazy, see alloc_log_graphs)
+            // vMatrix      - (ORDER_MAX+1) * (ORDER_MAX+2) doubles
+            const size_t szof_channels  = align_size(nChannels * sizeof(channel_t), OPTIMAL_ALIGN);
+            const size_t szof_buffer    = align_size(CHUNK_SIZE_MAX * sizeof(float), OPTIMAL_ALIGN);
+            const size_t szof_ovs       = align_size(CHUNK_SIZE_MAX * meta::shaper::OVERSAMPLING_MAX * sizeof(float), OPTIMAL_ALIGN);
+            const size_t szof_matrix    = align_size((meta::shaper::ORDER_MAX + 1) * (meta::shaper::ORDER_MAX + 2) * sizeof(double), OPTIMAL_ALIGN);
+            const size_t szof_lut       = align_size(meta::shaper::CURVE_LUT_SIZE * sizeof(float), OPTIMAL_ALIGN);
+            const size_t szof_graph     = align_size(meta::shaper::GRAPH_DOTS * sizeof(float), OPTIMAL_ALIGN);
+            const size_t to_alloc       =
+                szof_channels +
+                nChannels * 2 * (szof_buffer + szof_ovs) +
+                CURVES_TOTAL * (szof_lut + szof_graph) +
+                szof_matrix +
+                szof_graph;
+
+            uint8_t *ptr        = alloc_aligned<uint8_t>(pData, to_alloc, OPTIMAL_ALIGN);
+            if (ptr == NULL)
+                return;
+
+            channel_t *channels = advance_ptr_bytes<channel_t>(ptr, szof_channels);
+            vBuffer             = advance_ptr_bytes<float>(ptr, szof_buffer * nChannels);
+            vOvsBuffer          = advance_ptr_bytes<float>(ptr, szof_ovs * nChannels);
+            vFadeBuffer         = advance_ptr_bytes<float>(ptr, szof_ovs * nChannels);
+            vModeBuffer         = advance_ptr_bytes<float>(ptr, szof_buffer * nChannels);
+
+            for (size_t i=0; i<CURVES_TOTAL; ++i)
+            {
+                curve_t *c          = &vCurves[i];
+
+                dsp::fill_zero(c->vCoeffs, meta::shaper::ORDER_MAX + 1);
+                dsp::fill_zero(c->vAdaaCoeffs, meta::shaper::ORDER_MAX + 2);
+                dsp::fill_zero(c->vCoeffsB, meta::shaper::ORDER_MAX + 1);
+                dsp::fill_zero(c->vAdaaCoeffsB, meta::shaper::ORDER_MAX + 2);
+                dsp::fill_zero(c->vMorphCoeffs, meta::shaper::ORDER_MAX + 1);
+                dsp::fill_zero(c->vMorphAdaaCoeffs, meta::shaper::ORDER_MAX + 2);
+                c->fMorphApplied    = -1.0f;
+                c->nOrder           = meta::shaper::ORDER_DFL;
+                c->nMode            = CM_POLY;
+                c->nVersion         = 0;
+                c->nRefs            = 0;
+                c->pEvalK           = curve::polyeval_k_resolve(c->nOrder);
+                c->pEvalKX2         = curve::polyeval_k_x2_resolve(c->nOrder);
+                c->vLutLocal        = advance_ptr_bytes<float>(ptr, szof_lut);
+                c->vLut             = c->vLutLocal;
+                c->pShared          = NULL;
+                c->vLinGraph        = advance_ptr_bytes<float>(ptr, szof_graph);
+                c->vLogGraph        = NULL;
+            }
+
+            vMatrix             = advance_ptr_bytes<double>(ptr, szof_matrix);
+            vLinCoord           = advance_ptr_bytes<float>(ptr, szof_graph);
+
+            const float dx      = 2.0f / (meta::shaper::GRAPH_DOTS - 1);
+            for (size_t i=0; i<meta::shaper::GRAPH_DOTS; ++i)
+                vLinCoord[i]        = -1.0f + i * dx;
+
+            // Initialize channels: the arena memory is raw, so the DSP modules
+            // are brought up with their construct() calls before the channel
+            // array is published for teardown to see
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &channels[i];
+
+                c->vIn              = NULL;
+                c->vOut             = NULL;
+                c->vBuffer          = &vBuffer[i * CHUNK_SIZE_MAX];
+                c->vOvsBuffer       = &vOvsBuffer[i * CHUNK_SIZE_MAX * meta::shaper::OVERSAMPLING_MAX];
+                c->vFadeBuffer      = &vFadeBuffer[i * CHUNK_SIZE_MAX * meta::shaper::OVERSAMPLING_MAX];
+                c->vModeBuffer      = &vModeBuffer[i * CHUNK_SIZE_MAX];
+                c->fAdaaX1          = 0.0f;
+                c->fInLevel         = 0.0f;
+                c->fOutLevel        = 0.0f;
+
+                c->sBypass.construct();
+                c->sOver.construct();
+                c->sOver.init();
+                c->sDelay.construct();
+                c->sDelay.init(OVS_LATENCY_MAX);
+
+                c->pIn              = NULL;
+                c->pOut             = NULL;
+                c->pInMeter         = NULL;
+                c->pOutMeter        = NULL;
+            }
+            vChannels           = channels;
+
+        #ifdef LSP_SHAPER_EAGER_GRAPHS
+            // Some hosts dislike any allocation after init: carve the
+            // log-scale graph data up front instead of on first UI attach
+            if (!alloc_log_graphs())
+                return;
+        #endif /* LSP_SHAPER_EAGER_GRAPHS */
+
+            // Perform the initial fit synchronously so the audio thread always
+            // sees a valid curve before the first background task completes;
+            // identical instances share the result through the curve cache
+            produce_curve(&vCurves[0], &sCurveParams);
+            pActiveCurve        = &vCurves[0];
+            pActiveCurve->nVersion  = ++nCurveVersion;
+            pActiveCurve->nRefs = 1;
+            bCurveDirty         = false;
+
+            // Bind ports
+            lsp_trace("Binding ports");
+            size_t port_id      = 0;
+
+            // Bind input audio ports
+            for (size_t i=0; i<nChannels; ++i)
+                vChannels[i].pIn    = trace_port(ports[port_id++]);
+
+            // Bind output audio ports
+            for (size_t i=0; i<nChannels; ++i)
+                vChannels[i].pOut   = trace_port(ports[port_id++]);
+
+            // Bind common ports
+            pBypass             = trace_port(ports[port_id++]);
+            pGainIn             = trace_port(ports[port_id++]);
+            pGainOut            = trace_port(ports[port_id++]);
+            pHScale             = trace_port(ports[port_id++]);
+            pHShift             = trace_port(ports[port_id++]);
+            pVScale             = trace_port(ports[port_id++]);
+            pVShift             = trace_port(ports[port_id++]);
+            pHScaleB            = trace_port(ports[port_id++]);
+            pHShiftB            = trace_port(ports[port_id++]);
+            pVScaleB            = trace_port(ports[port_id++]);
+            pVShiftB            = trace_port(ports[port_id++]);
+            pMorph              = trace_port(ports[port_id++]);
+            pOrder              = trace_port(ports[port_id++]);
+            pOversampling       = trace_port(ports[port_id++]);
+            pOvsQuality         = trace_port(ports[port_id++]);
+            pCurveMode          = trace_port(ports[port_id++]);
+            pListen             = trace_port(ports[port_id++]);
+            pDither             = trace_port(ports[port_id++]);
+            pLinMesh            = trace_port(ports[port_id++]);
+            pLogMesh            = trace_port(ports[port_id++]);
+
+        #ifdef LSP_SHAPER_PROFILING
+            pProfOvs            = trace_port(ports[port_id++]);
+            pProfCurve          = trace_port(ports[port_id++]);
+            pProfSet            = trace_port(ports[port_id++]);
+        #endif /* LSP_SHAPER_PROFILING */
+
+            // Bind meters
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                vChannels[i].pInMeter   = trace_port(ports[port_id++]);
+                vChannels[i].pOutMeter  = trace_port(ports[port_id++]);
+            }
+        }
+
+        void shaper::destroy()
+        {
+            plug::Module::destroy();
+            do_destroy();
+        }
+
+        void shaper::do_destroy()
+        {
+            // Leave the shared worker pool: a fit task still queued or
+            // running must not outlive the instance state it renders into
+            if (bPoolBound)
+            {
+                curve::pool_cancel(&sCurveTask);
+                curve::pool_unbind();
+                bPoolBound          = false;
+            }
+
+            // Drop references to process-wide cached curves
+            for (size_t i=0; i<CURVES_TOTAL; ++i)
+            {
+                curve_t *c          = &vCurves[i];
+                if (c->pShared != NULL)
+                {
+                    curve::cache_release(c->pShared);
+                    c->pShared          = NULL;
+                }
+            }
+
+            if (vChannels != NULL)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    c->sDelay.destroy();
+                    c->sOver.destroy();
+                    c->sBypass.destroy();
+                }
+                // The channel memory itself is owned by the pData arena
+                vChannels           = NULL;
+            }
+
+            if (pIDisplay != NULL)
+            {
+                pIDisplay->destroy();
+                pIDisplay           = NULL;
+            }
+
+            free_aligned(pData);
+            free_aligned(pGraphData);
+        }
+
+        size_t shaper::select_chunk_size()  const
+        {
+            // An explicit environment override wins over the heuristic
+            if (nChunkOverride != 0)
+                return nChunkOverride;
+
+            // Pick the largest power-of-two chunk whose working set (host-rate
+            // and oversampled buffers across all channels) fits the cache
+            // budget at the active oversampling ratio: offline hosts handing
+            // large blocks then run few internal iterations, while high
+            // ratios shrink the chunk to keep the hot buffers cache-resident
+            const size_t ratio      = lsp_max(vChannels[0].sOver.get_oversampling(), size_t(1));
+            const size_t per_sample = nChannels * (2*ratio + 2) * sizeof(float);
+
+            size_t chunk            = CHUNK_SIZE_MIN;
+            while (((chunk << 1) * per_sample <= CHUNK_CACHE_BUDGET) && ((chunk << 1) <= CHUNK_SIZE_MAX))
+                chunk                 <<= 1;
+
+            return chunk;
+        }
+
+        bool shaper::alloc_log_graphs()
+        {
+            // Allocate the log-scale graph data: most instances never show a
+            // UI, so this is deferred to the first attach and performed on the
+            // worker thread as part of the fit task
+            const size_t szof_graph = align_size(meta::shaper::GRAPH_DOTS * sizeof(float), OPTIMAL_ALIGN);
+            uint8_t *ptr        = alloc_aligned<uint8_t>(pGraphData, (CURVES_TOTAL + 1) * szof_graph, OPTIMAL_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            for (size_t i=0; i<CURVES_TOTAL; ++i)
+                vCurves[i].vLogGraph    = advance_ptr_bytes<float>(ptr, szof_graph);
+
+            float *coord        = advance_ptr_bytes<float>(ptr, szof_graph);
+            const float ddb     = (meta::shaper::GRAPH_DB_MAX - meta::shaper::GRAPH_DB_MIN) / (meta::shaper::GRAPH_DOTS - 1);
+            for (size_t i=0; i<meta::shaper::GRAPH_DOTS; ++i)
+                coord[i]            = meta::shaper::GRAPH_DB_MIN + i * ddb;
+
+            // The carved buffers are raw arena memory, but the UI attach has
+            // already forced mesh republication, so the active curve's log
+            // mesh may be copied out before the pending fit installs: clear
+            // all graphs so that window shows a flat line instead of garbage.
+            // The real data arrives with the install of the running fit
+            for (size_t i=0; i<CURVES_TOTAL; ++i)
+                dsp::fill_zero(vCurves[i].vLogGraph, meta::shaper::GRAPH_DOTS);
+
+            // Publish the coordinate array last: the audio thread treats a
+            // non-NULL vLogCoord as the signal that all log data is valid.
+            // The release store pairs with the acquire load in sync_meshes()
+            // so the cleared graphs and the coordinates are visible before
+            // the pointer on weakly-ordered targets
+            atomic_store(&vLogCoord, coord);
+
+            return true;
+        }
+
+        dspu::over_mode_t shaper::decode_oversampling_mode(size_t mode, size_t quality)
+        {
+            // Low-latency quality trades a few dB of alias rejection for the
+            // shorter polyphase kernels, roughly halving the added latency
+            if (quality == OQ_LOW_LATENCY)
+            {
+                switch (mode)
+                {
+                    case 1:     return dspu::OM_LANCZOS_2X2;
+                    case 2:     return dspu::OM_LANCZOS_3X2;
+                    case 3:     return dspu::OM_LANCZOS_4X2;
+                    case 4:     return dspu::OM_LANCZOS_6X2;
+                    case 5:     return dspu::OM_LANCZOS_8X2;
+                    case 6:     return dspu::OM_LANCZOS_8X2;    // Auto mode runs the 8x kernel when engaged
+                    default:    break;
+                }
+                return dspu::OM_NONE;
+            }
+
+            switch (mode)
+            {
+                case 1:     return dspu::OM_LANCZOS_2X3;
+                case 2:     return dspu::OM_LANCZOS_3X3;
+                case 3:     return dspu::OM_LANCZOS_4X3;
+                case 4:     return dspu::OM_LANCZOS_6X3;
+                case 5:     return dspu::OM_LANCZOS_8X3;
+                case 6:     return dspu::OM_LANCZOS_8X3;    // Auto mode runs the 8x kernel when engaged
+                default:    break;
+            }
+            return dspu::OM_NONE;
+        }
+
+        void shaper::update_sample_rate(long sr)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                c->sBypass.init(sr);
+                c->sOver.set_sample_rate(sr);
+                c->sOver.update_settings();
+                c->sDelay.set_delay(c->sOver.latency());
+            }
+
+            nFadeTotal          = dspu::millis_to_samples(sr, meta::shaper::CURVE_XFADE_TIME);
+            nOvsFadePos         = nFadeTotal;
+            nSettleTotal        = dspu::millis_to_samples(sr, meta::shaper::CURVE_SETTLE_TIME);
+            nChunkSize          = select_chunk_size();
+
+            set_latency(vChannels[0].sOver.latency());
+        }
+
+        float shaper::curve_target(const curve_params_t *p, float x)
+        {
+            // Parametrized sigmoid: the slope is normalized so that the default
+            // settings map [-1, 1] onto [-1, 1]
+            const float k       = lsp_max(p->fHScale, 1e-3f);
+            const float norm    = 1.0f / tanhf(k);
+
+            return p->fVShift + p->fVScale * tanhf(k * (x + p->fHShift)) * norm;
+        }
+
+        void shaper::fit_coeffs(float *coeffs, const curve_params_t *p)
+        {
+            // Sample the target transfer function at uniformly-spaced points
+            // of [-1, 1] and delegate the least-squares solve over vMatrix to
+            // the curve module
+            const size_t np     = (p->nOrder + 1) * 4;  // Number of sample points
+
+            double vx[(meta::shaper::ORDER_MAX + 1) * 4];
+            double vy[(meta::shaper::ORDER_MAX + 1) * 4];
+            for (size_t s=0; s<np; ++s)
+            {
+                vx[s]               = -1.0 + (2.0 * s) / (np - 1);
+                vy[s]               = curve_target(p, vx[s]);
+            }
+
+            dsp::fill_zero(coeffs, meta::shaper::ORDER_MAX + 1);
+            curve::polyfit(coeffs, vMatrix, vx, vy, np, p->nOrder);
+        }
+
+        void shaper::fit_curve(curve_t *c, const curve_params_t *p)
+        {
+            fit_coeffs(c->vCoeffs, p);
+
+            c->nOrder           = p->nOrder;
+            c->nMode            = p->nMode;
+
+            // Resolve the evaluators once per fit: orders common in presets
+            // map to fully unrolled template instantiations
+            c->pEvalK           = curve::polyeval_k_resolve(c->nOrder);
+            c->pEvalKX2         = curve::polyeval_k_x2_resolve(c->nOrder);
+        }
+
+        bool shaper::kvt_restore_curve(curve_t *c, const curve_params_t *p)
+        {
+            core::KVTStorage *kvt   = pWrapper->kvt_lock();
+            if (kvt == NULL)
+                return false;
+            lsp_finally { pWrapper->kvt_release(); };
+
+            const core::kvt_param_t *param  = NULL;
+            if (kvt->get(CURVE_KVT_PATH, &param) != STATUS_OK)
+                return false;
+            if ((param == NULL) || (param->type != core::KVT_BLOB))
+                return false;
+            if ((param->blob.data == NULL) || (param->blob.size != sizeof(curve_blob_t)))
+                return false;
+
+            const curve_blob_t *blob    = static_cast<const curve_blob_t *>(param->blob.data);
+            if ((blob->nMagic != CURVE_BLOB_MAGIC) || (blob->nVersion != CURVE_BLOB_VERSION))
+                return false;
+
+            // The persisted coefficients are usable only when they were
+            // fitted for exactly the parameters being committed now; anything
+            // else (edited session file, changed defaults) falls back to the
+            // regular fit
+            if ((blob->fHScale != p->fHScale) || (blob->fHShift != p->fHShift) ||
+                (blob->fVScale != p->fVScale) || (blob->fVShift != p->fVShift) ||
+                (blob->nOrder != p->nOrder))
+                return false;
+
+            // A corrupt chunk must never reach the audio path
+            for (size_t j=0; j<=p->nOrder; ++j)
+                if (!isfinite(blob->vCoeffs[j]))
+                    return false;
+
+            dsp::fill_zero(c->vCoeffs, meta::shaper::ORDER_MAX + 1);
+            dsp::copy(c->vCoeffs, blob->vCoeffs, p->nOrder + 1);
+            c->nOrder           = p->nOrder;
+            c->nMode            = p->nMode;
+            c->pEvalK           = curve::polyeval_k_resolve(c->nOrder);
+            c->pEvalKX2         = curve::polyeval_k_x2_resolve(c->nOrder);
+
+            return true;
+        }
+
+        void shaper::kvt_save_curve(const curve_t *c, const curve_params_t *p)
+        {
+            curve_blob_t blob;
+            blob.nMagic         = CURVE_BLOB_MAGIC;
+            blob.nVersion       = CURVE_BLOB_VERSION;
+            blob.fHScale        = p->fHScale;
+            blob.fHShift        = p->fHShift;
+            blob.fVScale        = p->fVScale;
+            blob.fVShift        = p->fVShift;
+            blob.nOrder         = uint32_t(p->nOrder);
+            dsp::fill_zero(blob.vCoeffs, meta::shaper::ORDER_MAX + 1);
+            dsp::copy(blob.vCoeffs, c->vCoeffs, p->nOrder + 1);
+
+            core::KVTStorage *kvt   = pWrapper->kvt_lock();
+            if (kvt == NULL)
+                return;
+            lsp_finally { pWrapper->kvt_release(); };
+
+            // The storage makes its own copy of the blob contents
+            core::kvt_param_t param;
+            param.type          = core::KVT_BLOB;
+            param.blob.ctype    = const_cast<char *>(CURVE_KVT_CTYPE);
+            param.blob.data     = &blob;
+            param.blob.size     = sizeof(curve_blob_t);
+            kvt->put(CURVE_KVT_PATH, &param, core::KVT_PRIVATE);
+        }
+
+        void shaper::render_lut(curve_t *c)
+        {
+            // Render the fitted polynomial into a dense table over [-1, 1];
+            // the audio path then replaces Horner evaluation with a clamped
+            // linear interpolation of the table
+            const float dx      = 2.0f / (meta::shaper::CURVE_LUT_SIZE - 1);
+            for (size_t i=0; i<meta::shaper::CURVE_LUT_SIZE; ++i)
+                c->vLut[i]          = -1.0f + i * dx;
+            curve::polyeval(c->vLut, c->vLut, c->vCoeffs, c->nOrder, meta::shaper::CURVE_LUT_SIZE);
+        }
+
+        void shaper::render_adaa(curve_t *c)
+        {
+            // Integrate the fitted polynomial term by term: F'(x) = P(x). The
+            // integration constant is irrelevant since the ADAA difference
+            // quotient only ever uses F(x) - F(x1). The antiderivative is kept
+            // for every curve regardless of the evaluation mode, so switching
+            // into ADAA never waits for a refit
+            dsp::fill_zero(c->vAdaaCoeffs, meta::shaper::ORDER_MAX + 2);
+            dsp::fill_zero(c->vAdaaCoeffsB, meta::shaper::ORDER_MAX + 2);
+            for (size_t j=0; j<=c->nOrder; ++j)
+            {
+                c->vAdaaCoeffs[j+1]     = c->vCoeffs[j] / float(j + 1);
+                c->vAdaaCoeffsB[j+1]    = c->vCoeffsB[j] / float(j + 1);
+            }
+        }
+
+        void shaper::render_graphs(curve_t *c)
+        {
+            // Linear graph: transfer curve over [-1, 1]
+            curve::polyeval(c->vLinGraph, vLinCoord, c->vCoeffs, c->nOrder, meta::shaper::GRAPH_DOTS);
+
+            // Logarithmic graph: output level in dB vs input level in dB;
+            // skipped until the log data has been allocated on first UI attach
+            if ((vLogCoord == NULL) || (c->vLogGraph == NULL))
+                return;
+
+            for (size_t i=0; i<meta::shaper::GRAPH_DOTS; ++i)
+                c->vLogGraph[i]     = dspu::db_to_gain(vLogCoord[i]);
+            curve::polyeval(c->vLogGraph, c->vLogGraph, c->vCoeffs, c->nOrder, meta::shaper::GRAPH_DOTS);
+            for (size_t i=0; i<meta::shaper::GRAPH_DOTS; ++i)
+                c->vLogGraph[i]     = dspu::gain_to_db(lsp_max(fabsf(c->vLogGraph[i]), GAIN_AMP_M_120_DB));
+        }
+
+        status_t shaper::fit_task()
+        {
+            // Executed on the worker thread: render the complete curve state
+            // into the inactive buffer, the audio thread installs it afterwards
+            curve_t *c          = pFitCurve;
+            if (c == NULL)
+                return STATUS_OK;
+
+            // First fit after a UI attach also allocates the log graph data;
+            // doing it here keeps the allocation off the audio thread
+            if ((nUIRefs > 0) && (vLogCoord == NULL))
+                alloc_log_graphs();
+
+            produce_curve(c, &sCurveParams);
+
+            // Persist the fitted curve with the session so the next restore
+            // installs it without the matrix solve
+            kvt_save_curve(c, &sCurveParams);
+
+            return STATUS_OK;
+        }
+
+        void shaper::produce_curve(curve_t *c, const curve_params_t *p)
+        {
+            // Release the shared curve previously referenced by this buffer
+            // and fall back to instance-owned lookup table storage
+            if (c->pShared != NULL)
+            {
+                curve::cache_release(c->pShared);
+                c->pShared          = NULL;
+            }
+            c->vLut             = c->vLutLocal;
+
+            // Probe the process-wide cache: template-instantiated sessions run
+            // many instances with identical fit parameters, so the matrix
+            // solve and LUT render are usually already done
+            curve::shared_t *sh = curve::cache_acquire(p->fHScale, p->fHShift, p->fVScale, p->fVShift, p->nOrder);
+            if (sh != NULL)
+            {
+                dsp::fill_zero(c->vCoeffs, meta::shaper::ORDER_MAX + 1);
+                dsp::copy(c->vCoeffs, sh->vCoeffs, p->nOrder + 1);
+                c->nOrder           = p->nOrder;
+                c->nMode            = p->nMode;
+                c->pEvalK           = curve::polyeval_k_resolve(c->nOrder);
+                c->pEvalKX2         = curve::polyeval_k_x2_resolve(c->nOrder);
+                c->pShared          = sh;
+
+                if (c->nMode == CM_LUT)
+                {
+                    // A polynomial-mode instance may have cached the curve
+                    // without a table: render once and attach it for everyone
+                    if (sh->vLut == NULL)
+                    {
+                        render_lut(c);
+                        curve::cache_attach_lut(sh, c->vLutLocal, meta::shaper::CURVE_LUT_SIZE);
+                    }
+                    if (sh->vLut != NULL)
+                        c->vLut             = const_cast<float *>(sh->vLut);
+                }
+            }
+            else
+            {
+                // Coefficients persisted with the session skip the matrix
+                // solve when they match the requested parameters exactly
+                if (!kvt_restore_curve(c, p))
+                    fit_curve(c, p);
+                if (c->nMode == CM_LUT)
+                    render_lut(c);
+
+                c->pShared          = curve::cache_commit(p->fHScale, p->fHShift, p->fVScale, p->fVShift, p->nOrder,
+                    c->vCoeffs,
+                    (c->nMode == CM_LUT) ? c->vLutLocal : NULL,
+                    meta::shaper::CURVE_LUT_SIZE);
+                if ((c->pShared != NULL) && (c->nMode == CM_LUT) && (c->pShared->vLut != NULL))
+                    c->vLut             = const_cast<float *>(c->pShared->vLut);
+            }
+
+            // Solve morph endpoint B directly: the cache key and the session
+            // blob cover endpoint A only, and the solve itself is cheap
+            // compared to the LUT and graph rendering
+            curve_params_t pb   = *p;
+            pb.fHScale          = p->fHScaleB;
+            pb.fHShift          = p->fHShiftB;
+            pb.fVScale          = p->fVScaleB;
+            pb.fVShift          = p->fVShiftB;
+            fit_coeffs(c->vCoeffsB, &pb);
+
+            render_adaa(c);
+            render_graphs(c);
+        }
+
+        bool shaper::offline_render() const
+        {
+            // The wrapper does not forward the host's freewheel flag to the
+            // module, so attached UIs serve as the realtime indication:
+            // offline renders never open the editor. This is the single place
+            // to rewire once the framework exposes the flag directly.
+            return nUIRefs == 0;
+        }
+
+        void shaper::update_curve_state()
+        {
+            // Install the curve rendered by a completed fit task: the previous
+            // curve keeps its reference and is crossfaded out over a short
+            // ramp. Installation waits for a still-running crossfade so the
+            // ramp never restarts mid-way, but the fit itself already ran in
+            // the background during the fade
+            if ((sCurveTask.completed()) && (pFadeCurve == NULL))
+            {
+                if (pFitCurve != NULL)
+                {
+                    pFadeCurve          = pActiveCurve;
+                    pActiveCurve        = pFitCurve;
+                    pActiveCurve->nVersion  = ++nCurveVersion;
+                    pActiveCurve->fMorphApplied = -1.0f;    // Interpolated arrays are stale for the new fit
+                    pFitCurve           = NULL;
+                    nFadePos            = 0;
+                }
+                sCurveTask.reset();
+            }
+
+            // Launch a new fit task once the curve parameters have settled,
+            // rendering into any curve buffer not referenced by a role
+            if ((bCurveDirty) && (nSettleLeft == 0) && (sCurveTask.idle()))
+            {
+                curve_t *fit        = NULL;
+                for (size_t i=0; i<CURVES_TOTAL; ++i)
+                    if (vCurves[i].nRefs == 0)
+                    {
+                        fit                 = &vCurves[i];
+                        break;
+                    }
+                if (fit == NULL)
+                    return;
+
+                sCurveParams.fHScale    = fHScale;
+                sCurveParams.fHShift    = fHShift;
+                sCurveParams.fVScale    = fVScale;
+                sCurveParams.fVShift    = fVShift;
+                sCurveParams.fHScaleB   = fHScaleB;
+                sCurveParams.fHShiftB   = fHShiftB;
+                sCurveParams.fVScaleB   = fVScaleB;
+                sCurveParams.fVShiftB   = fVShiftB;
+                sCurveParams.nOrder     = nOrder;
+                sCurveParams.nMode      = nCurveMode;
+
+                pFitCurve           = fit;
+                pFitCurve->nRefs    = 1;
+
+                // Prefer the shared pool, which serves audible instances
+                // first and bounds total background CPU; fall back to the
+                // per-instance wrapper executor when the pool is unavailable
+                const bool audible  = !vChannels[0].sBypass.bypassing();
+                bool submitted      = (bPoolBound) && (curve::pool_submit(&sCurveTask, audible));
+                if (!submitted)
+                {
+                    ipc::IExecutor *executor = pWrapper->get_executor();
+                    submitted           = (executor != NULL) && (executor->submit(&sCurveTask));
+                }
+
+                if (submitted)
+                    bCurveDirty         = false;
+                else
+                {
+                    pFitCurve->nRefs    = 0;
+                    pFitCurve           = NULL;
+                }
+            }
+        }
+
+        void shaper::update_settings()
+        {
+        #ifdef LSP_SHAPER_PROFILING
+            const uint64_t prof_start   = prof_now();
+            lsp_finally {
+                prof_commit(&sProfSet, prof_now() - prof_start);
+                prof_report(&sProfSet, pProfSet);
+            };
+        #endif /* LSP_SHAPER_PROFILING */
+
+            // Pack all DSP-relevant values into one cache-line snapshot and
+            // publish it under the sequence counter; the audio thread applies
+            // it once per block instead of re-reading every port
+            snapshot_t s;
+            s.fGainIn           = pGainIn->value();
+            s.fGainOut          = pGainOut->value();
+            s.fHScale           = pHScale->value();
+            s.fHShift           = pHShift->value();
+            s.fVScale           = pVScale->value();
+            s.fVShift           = pVShift->value();
+            s.fHScaleB          = pHScaleB->value();
+            s.fHShiftB          = pHShiftB->value();
+            s.fVScaleB          = pVScaleB->value();
+            s.fVShiftB          = pVShiftB->value();
+            s.fMorph            = pMorph->value();
+            s.nOrder            = lsp_limit(ssize_t(pOrder->value()), meta::shaper::ORDER_MIN, meta::shaper::ORDER_MAX);
+            s.nCurveMode        = uint32_t(pCurveMode->value());
+            s.nOversampling     = uint32_t(pOversampling->value());
+            s.nOvsQuality       = uint32_t(pOvsQuality->value());
+            s.nFlags            =
+                ((pBypass->value() >= 0.5f) ? SF_BYPASS : 0) |
+                ((pListen->value() >= 0.5f) ? SF_LISTEN : 0) |
+                ((pDither->value() >= 0.5f) ? SF_DITHER : 0);
+
+            atomic_add(&nSnapSeq, 1);       // Odd: write in progress
+            sSnapshot           = s;
+            atomic_add(&nSnapSeq, 1);       // Even: snapshot consistent
+            atomic_add(&nSnapVersion, 1);
+        }
+
+        bool shaper::fetch_snapshot(snapshot_t *dst)
+        {
+            // Nothing published since the last applied generation
+            const uatomic_t version = nSnapVersion;
+            if (version == nSnapApplied)
+                return false;
+
+            // Seqlock read: retry while a writer holds the odd sequence or
+            // the sequence moved during the copy
+            uatomic_t s1, s2;
+            do
+            {
+                s1                  = nSnapSeq;
+                *dst                = sSnapshot;
+                s2                  = nSnapSeq;
+            } while ((s1 != s2) || (s1 & 1));
+
+            nSnapApplied        = version;
+            return true;
+        }
+
+        void shaper::commit_settings(const snapshot_t *s)
+        {
+            // Cheap parameters: no impact on the fitted curve. The morph
+            // position only drives the coefficient interpolation, so
+            // automating it never schedules a refit
+            fGainIn             = s->fGainIn;
+            fGainOut            = s->fGainOut;
+            fMorph              = s->fMorph;
+            bMorph              = fMorph > 0.0f;
+            bListen             = (s->nFlags & SF_LISTEN) != 0;
+            bDither             = (s->nFlags & SF_DITHER) != 0;
+
+            // Curve parameters: track which ones actually changed so the fit
+            // task is scheduled only when the curve moves
+            if ((s->fHScale != fHScale) || (s->fHShift != fHShift) ||
+                (s->fVScale != fVScale) || (s->fVShift != fVShift) ||
+                (s->fHScaleB != fHScaleB) || (s->fHShiftB != fHShiftB) ||
+                (s->fVScaleB != fVScaleB) || (s->fVShiftB != fVShiftB) ||
+                (s->nOrder != nOrder) || (s->nCurveMode != nCurveMode))
+            {
+                fHScale             = s->fHScale;
+                fHShift             = s->fHShift;
+                fVScale             = s->fVScale;
+                fVShift             = s->fVShift;
+                fHScaleB            = s->fHScaleB;
+                fHShiftB            = s->fHShiftB;
+                fVScaleB            = s->fVScaleB;
+                fVShiftB            = s->fVShiftB;
+                nOrder              = s->nOrder;
+                nCurveMode          = s->nCurveMode;
+                bCurveDirty         = true;
+
+                // Restart the settle window: bursts of port writes (session
+                // restore, preset switches, knob drags) are absorbed and a
+                // single fit runs once the parameters stop moving
+                nSettleLeft         = nSettleTotal;
+            }
+
+            // Update oversampling mode
+            if ((s->nOversampling != nOversampling) || (s->nOvsQuality != nOvsQuality))
+            {
+                nOversampling       = s->nOversampling;
+                nOvsQuality         = s->nOvsQuality;
+                bAutoOvs            = (nOversampling == 6);
+                bAdaa               = (nOversampling == 7);
+                bOvsActive          = (nOversampling != 0) && (!bAutoOvs) && (!bAdaa);
+                nOvsFadePos         = nFadeTotal;
+
+                const dspu::over_mode_t om  = decode_oversampling_mode(nOversampling, nOvsQuality);
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    c->sOver.set_mode(om);
+                    c->sOver.update_settings();
+                    c->sDelay.set_delay(c->sOver.latency());
+                }
+                set_latency(vChannels[0].sOver.latency());
+                nChunkSize          = select_chunk_size();
+            }
+
+            const bool bypass   = (s->nFlags & SF_BYPASS) != 0;
+            for (size_t i=0; i<nChannels; ++i)
+                vChannels[i].sBypass.set_bypass(bypass);
+        }
+
+        void shaper::update_morph(curve_t *c)
+        {
+            // Rebuild the interpolated coefficient sets only when the morph
+            // position or the underlying fit actually moved. Polynomial
+            // evaluation is linear in the coefficients, so interpolating them
+            // yields exactly the pointwise interpolation of the two endpoint
+            // transfer curves; the same holds for the antiderivatives used by
+            // the ADAA kernel
+            if (c->fMorphApplied == fMorph)
+                return;
+
+            dsp::mix_copy2(c->vMorphCoeffs, c->vCoeffs, c->vCoeffsB,
+                1.0f - fMorph, fMorph, meta::shaper::ORDER_MAX + 1);
+            dsp::mix_copy2(c->vMorphAdaaCoeffs, c->vAdaaCoeffs, c->vAdaaCoeffsB,
+                1.0f - fMorph, fMorph, meta::shaper::ORDER_MAX + 2);
+            c->fMorphApplied    = fMorph;
+        }
+
+        void shaper::apply_curve(const curve_t *c, float *dst, const float *src, float gain, size_t count)
+        {
+            // The output gain is fused into the evaluation pass; since all
+            // downstream stages (downsampling, crossfades) are linear, the
+            // result is identical to a separate scaling pass over the block.
+            // While morphing, the interpolated coefficients drive the
+            // polynomial kernel even in LUT mode: the endpoint tables do not
+            // describe the interpolated curve, the same convention the ADAA
+            // path uses.
+            // In listen mode the output is the shaping residue gain*(P(x)-x):
+            // the mix kernels evaluate, scale and subtract the dry signal in
+            // one pass, with the dry argument simply aliasing the source block
+            if (bListen)
+            {
+                if (bMorph)
+                    curve::polyeval_mix(dst, src, src, c->vMorphCoeffs, c->nOrder, gain, -gain, count);
+                else if (c->nMode == CM_LUT)
+                    curve::lut_process_mix(dst, src, src, c->vLut, meta::shaper::CURVE_LUT_SIZE, gain, -gain, count);
+                else
+                    curve::polyeval_mix(dst, src, src, c->vCoeffs, c->nOrder, gain, -gain, count);
+            }
+            else if (bMorph)
+                c->pEvalK(dst, src, c->vMorphCoeffs, c->nOrder, gain, count);
+            else if (c->nMode == CM_LUT)
+                curve::lut_process_k(dst, src, c->vLut, meta::shaper::CURVE_LUT_SIZE, gain, count);
+            else
+                c->pEvalK(dst, src, c->vCoeffs, c->nOrder, gain, count);
+        }
+
+        void shaper::apply_curve_x2(const curve_t *c, float *dst_l, float *dst_r, const float *src_l, const float *src_r, float gain, size_t count)
+        {
+            // The mix kernels have no paired variant: the residue monitor is
+            // an inspection mode, so it falls back to two single-channel
+            // passes instead of growing the kernel matrix
+            if (bListen)
+            {
+                apply_curve(c, dst_l, src_l, gain, count);
+                apply_curve(c, dst_r, src_r, gain, count);
+            }
+            else if (bMorph)
+                c->pEvalKX2(dst_l, dst_r, src_l, src_r, c->vMorphCoeffs, c->nOrder, gain, count);
+            else if (c->nMode == CM_LUT)
+                curve::lut_process_k_x2(dst_l, dst_r, src_l, src_r, c->vLut, meta::shaper::CURVE_LUT_SIZE, gain, count);
+            else
+                c->pEvalKX2(dst_l, dst_r, src_l, src_r, c->vCoeffs, c->nOrder, gain, count);
+        }
+
+        void shaper::shape_chunk(channel_t *ch, float *dst, const float *src, float gain, size_t count, float fade_t0, float fade_dt)
+        {
+            // Apply the transfer curve; while a curve swap is in progress, both
+            // curves are evaluated and crossfaded with a linear ramp
+            const curve_t *fade = pFadeCurve;
+            if (fade != NULL)
+            {
+                apply_curve(fade, ch->vFadeBuffer, src, gain, count);
+                apply_curve(pActiveCurve, dst, src, gain, count);
+                curve::xfade(dst, ch->vFadeBuffer, dst, fade_t0, fade_dt, count);
+            }
+            else
+                apply_curve(pActiveCurve, dst, src, gain, count);
+        }
+
+        void shaper::shape_chunk_x2(channel_t *l, channel_t *r, float *dst_l, float *dst_r, const float *src_l, const float *src_r, float gain, size_t count, float fade_t0, float fade_dt)
+        {
+            // Stereo fast path: both channels run through one paired kernel
+            // call sharing a single load of the curve coefficients
+            const curve_t *fade = pFadeCurve;
+            if (fade != NULL)
+            {
+                apply_curve_x2(fade, l->vFadeBuffer, r->vFadeBuffer, src_l, src_r, gain, count);
+                apply_curve_x2(pActiveCurve, dst_l, dst_r, src_l, src_r, gain, count);
+                curve::xfade(dst_l, l->vFadeBuffer, dst_l, fade_t0, fade_dt, count);
+                curve::xfade(dst_r, r->vFadeBuffer, dst_r, fade_t0, fade_dt, count);
+            }
+            else
+                apply_curve_x2(pActiveCurve, dst_l, dst_r, src_l, src_r, gain, count);
+        }
+
+        void shaper::shape_chunk_adaa(channel_t *ch, float *dst, const float *src, float gain, size_t count, float fade_t0, float fade_dt)
+        {
+            // Antialiased shaping at 1x rate: the ADAA kernel always evaluates
+            // the fitted polynomial, so the curve mode selector only affects
+            // the oversampled and plain paths. Both fade curves see the same
+            // input, so they share the single-sample history, which is
+            // advanced once after all evaluations; the last input sample is
+            // captured up front because dst may alias src
+            const float x1      = ch->fAdaaX1;
+            const float x_last  = src[count - 1];
+
+            // The ADAA kernel has no fused mix variant, so the residue
+            // monitor subtracts the scaled dry signal in a separate pass.
+            // The dry block has to be preserved up front because dst may
+            // alias src; vModeBuffer is free scratch here, the ADAA path
+            // never runs together with the oversampler
+            if (bListen)
+                dsp::copy(ch->vModeBuffer, src, count);
+
+            const curve_t *act  = pActiveCurve;
+            const float *ac     = (bMorph) ? act->vMorphCoeffs : act->vCoeffs;
+            const float *aic    = (bMorph) ? act->vMorphAdaaCoeffs : act->vAdaaCoeffs;
+
+            const curve_t *fade = pFadeCurve;
+            if (fade != NULL)
+            {
+                const float *fc     = (bMorph) ? fade->vMorphCoeffs : fade->vCoeffs;
+                const float *fic    = (bMorph) ? fade->vMorphAdaaCoeffs : fade->vAdaaCoeffs;
+
+                curve::adaa(ch->vFadeBuffer, src, fc, fic, fade->nOrder, gain, x1, count);
+                curve::adaa(dst, src, ac, aic, act->nOrder, gain, x1, count);
+                curve::xfade(dst, ch->vFadeBuffer, dst, fade_t0, fade_dt, count);
+            }
+            else
+                curve::adaa(dst, src, ac, aic, act->nOrder, gain, x1, count);
+
+            if (bListen)
+                dsp::fmadd_k3(dst, ch->vModeBuffer, -gain, count);
+
+            ch->fAdaaX1         = x_last;
+        }
+
+        void shaper::process(size_t samples)
+        {
+            // Enable FTZ/DAZ for the whole DSP core: denormals in the
+            // oversampler filter states otherwise dominate the CPU cost on
+            // decaying tails
+            dsp::context_t ctx;
+            dsp::start(&ctx);
+            lsp_finally { dsp::finish(&ctx); };
+
+            // Apply the most recent parameter snapshot, if any
+            snapshot_t snap;
+            if (fetch_snapshot(&snap))
+                commit_settings(&snap);
+
+            // Pick up finished fit results and schedule pending refits
+            update_curve_state();
+
+            // Refresh the morph-interpolated coefficient sets for the curves
+            // this block evaluates; a vectorized lerp over a few dozen floats,
+            // so automating the morph port costs no refit and no matrix solve
+            if (bMorph)
+            {
+                update_morph(pActiveCurve);
+                if (pFadeCurve != NULL)
+                    update_morph(pFadeCurve);
+            }
+
+            // Offline fast path: with no UI attached, meters and graphs have
+            // no consumer, so all UI-facing work is skipped and each chunk
+            // runs at full vBuffer capacity
+            const bool ui_work  = !offline_render();
+
+            // Bind audio buffers
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                c->vIn              = c->pIn->buffer<float>();
+                c->vOut             = c->pOut->buffer<float>();
+            }
+
+            // Process the signal in chunks of at most nChunkSize samples
+            for (size_t offset=0; offset<samples; )
+            {
+                const size_t to_do  = lsp_min(samples - offset, nChunkSize);
+
+                // Crossfade window for this chunk, expressed at base sample rate
+                const curve_t *fade = pFadeCurve;
+                float fade_t0       = 0.0f;
+                float fade_dt       = 0.0f;
+                if (fade != NULL)
+                {
+                    const float t1      = lsp_min(float(nFadePos + to_do) / float(nFadeTotal), 1.0f);
+                    fade_t0             = float(nFadePos) / float(nFadeTotal);
+                    fade_dt             = (t1 - fade_t0) / to_do;
+                }
+
+                // In auto mode, engage the oversampler only when the block peak
+                // reaches a level where the curve's nonlinearity starts to alias
+                const bool mode_fading  = (bAutoOvs) && (nOvsFadePos < nFadeTotal);
+                if ((bAutoOvs) && (!mode_fading))
+                {
+                    float peak          = 0.0f;
+                    for (size_t i=0; i<nChannels; ++i)
+                        peak                = lsp_max(peak, dsp::abs_max(&vChannels[i].vIn[offset], to_do));
+                    peak               *= fGainIn;
+
+                    const bool engage   = (bOvsActive) ?
+                        (peak >= meta::shaper::AUTO_OVS_OFF_LEVEL) :
+                        (peak >= meta::shaper::AUTO_OVS_ON_LEVEL);
+                    if (engage != bOvsActive)
+                    {
+                        bOvsActive          = engage;
+                        nOvsFadePos         = 0;
+
+                        // The 1x leg was idle while the oversampler was
+                        // engaged: drop its stale alignment history so the
+                        // fade-in starts from silence instead of old signal
+                        if (!engage)
+                        {
+                            for (size_t i=0; i<nChannels; ++i)
+                                vChannels[i].sDelay.clear();
+                        }
+                    }
+                }
+                const bool run_ovs      = (bOvsActive) || (mode_fading) || (nOvsFadePos < nFadeTotal);
+                const bool run_plain    = (!bOvsActive) || (mode_fading) || (nOvsFadePos < nFadeTotal);
+
+                float mode_t0       = 0.0f;
+                float mode_dt       = 0.0f;
+                if (run_ovs && run_plain)
+                {
+                    const float t1      = lsp_min(float(nOvsFadePos + to_do) / float(nFadeTotal), 1.0f);
+                    mode_t0             = float(nOvsFadePos) / float(nFadeTotal);
+                    mode_dt             = (t1 - mode_t0) / to_do;
+                }
+
+                const size_t times  = vChannels[0].sOver.get_oversampling();
+
+            #ifdef LSP_SHAPER_PROFILING
+                uint64_t prof_mark  = prof_now();
+            #endif /* LSP_SHAPER_PROFILING */
+
+                // Phase 1: apply input gain and oversample each channel into
+                // its own buffers
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+
+                    dsp::mul_k3(c->vBuffer, &c->vIn[offset], fGainIn, to_do);
+                    if (bDither)
+                        dsp::add_k2(c->vBuffer, meta::shaper::DITHER_DC, to_do);
+
+                    if (run_ovs)
+                        c->sOver.upsample(c->vOvsBuffer, c->vBuffer, to_do);
+                }
+
+            #ifdef LSP_SHAPER_PROFILING
+                {
+                    const uint64_t now  = prof_now();
+                    prof_commit(&sProfOvs, now - prof_mark);
+                    prof_mark           = now;
+                }
+            #endif /* LSP_SHAPER_PROFILING */
+
+                // Phase 2: apply the transfer curve. Stereo runs both channels
+                // through one paired kernel pass, mono falls back to the
+                // single-channel kernels
+                if (nChannels == 2)
+                {
+                    channel_t *l        = &vChannels[0];
+                    channel_t *r        = &vChannels[1];
+
+                    if (run_ovs)
+                        shape_chunk_x2(l, r, l->vOvsBuffer, r->vOvsBuffer, l->vOvsBuffer, r->vOvsBuffer, fGainOut, to_do * times, fade_t0, fade_dt / times);
+                    if (run_plain)
+                    {
+                        if (bAdaa)
+                        {
+                            shape_chunk_adaa(l, l->vBuffer, l->vBuffer, fGainOut, to_do, fade_t0, fade_dt);
+                            shape_chunk_adaa(r, r->vBuffer, r->vBuffer, fGainOut, to_do, fade_t0, fade_dt);
+                        }
+                        else
+                            shape_chunk_x2(l, r, l->vBuffer, r->vBuffer, l->vBuffer, r->vBuffer, fGainOut, to_do, fade_t0, fade_dt);
+                    }
+                }
+                else
+                {
+                    channel_t *c        = &vChannels[0];
+
+                    if (run_ovs)
+                        shape_chunk(c, c->vOvsBuffer, c->vOvsBuffer, fGainOut, to_do * times, fade_t0, fade_dt / times);
+                    if (run_plain)
+                    {
+                        if (bAdaa)
+                            shape_chunk_adaa(c, c->vBuffer, c->vBuffer, fGainOut, to_do, fade_t0, fade_dt);
+                        else
+                            shape_chunk(c, c->vBuffer, c->vBuffer, fGainOut, to_do, fade_t0, fade_dt);
+                    }
+                }
+
+                // In auto mode the oversampled leg carries the resampler
+                // latency; delay the 1x leg by the same amount so the mode
+                // crossfade blends aligned signals and the reported latency
+                // holds whether or not the oversampler is engaged
+                if ((bAutoOvs) && (run_plain))
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        channel_t *c        = &vChannels[i];
+                        c->sDelay.process(c->vBuffer, c->vBuffer, to_do);
+                    }
+                }
+
+            #ifdef LSP_SHAPER_PROFILING
+                {
+                    const uint64_t now  = prof_now();
+                    prof_commit(&sProfCurve, now - prof_mark);
+                    prof_mark           = now;
+                }
+            #endif /* LSP_SHAPER_PROFILING */
+
+                // Phase 3: downsample, blend oversampler mode transitions and
+                // produce the output
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+
+                    if (run_ovs)
+                        c->sOver.downsample(c->vModeBuffer, c->vOvsBuffer, to_do);
+
+                    // Blend the two paths on mode transitions
+                    if (run_ovs && run_plain)
+                    {
+                        const float *pa     = (bOvsActive) ? c->vBuffer : c->vModeBuffer;
+                        const float *pb     = (bOvsActive) ? c->vModeBuffer : c->vBuffer;
+                        curve::xfade(c->vBuffer, pa, pb, mode_t0, mode_dt, to_do);
+                    }
+                    else if (run_ovs)
+                        dsp::copy(c->vBuffer, c->vModeBuffer, to_do);
+
+                    // Apply bypass; the output gain has already been applied
+                    // inside the shaping pass
+                    c->sBypass.process(&c->vOut[offset], &c->vIn[offset], c->vBuffer, to_do);
+                }
+
+            #ifdef LSP_SHAPER_PROFILING
+                prof_commit(&sProfOvs, prof_now() - prof_mark);
+            #endif /* LSP_SHAPER_PROFILING */
+
+                // Phase 4: metering post-pass, detached from the processing
+                // loops and skipped entirely when no UI is attached. The input
+                // peak is reduced over the untouched host buffer and scaled,
+                // which is equivalent to measuring after the gain stage
+                if (ui_work)
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        channel_t *c        = &vChannels[i];
+                        c->fInLevel         = lsp_max(c->fInLevel, dsp::abs_max(&c->vIn[offset], to_do) * fGainIn);
+                        c->fOutLevel        = lsp_max(c->fOutLevel, dsp::abs_max(c->vBuffer, to_do));
+                    }
+                }
+
+                // Advance the crossfades after all channels have processed the chunk
+                if (fade != NULL)
+                {
+                    nFadePos           += to_do;
+                    if (nFadePos >= nFadeTotal)
+                    {
+                        --pFadeCurve->nRefs;
+                        pFadeCurve          = NULL;
+                    }
+                }
+                if (nOvsFadePos < nFadeTotal)
+                    nOvsFadePos         = lsp_min(nOvsFadePos + to_do, size_t(nFadeTotal));
+
+                offset             += to_do;
+            }
+
+            // Advance the settle window for pending curve changes
+            nSettleLeft         = (nSettleLeft > samples) ? nSettleLeft - samples : 0;
+
+            // Report meters
+            if (ui_work)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    c->pInMeter->set_value(c->fInLevel);
+                    c->pOutMeter->set_value(c->fOutLevel);
+                    c->fInLevel         = 0.0f;
+                    c->fOutLevel        = 0.0f;
+                }
+            }
+
+        #ifdef LSP_SHAPER_PROFILING
+            prof_report(&sProfOvs, pProfOvs);
+            prof_report(&sProfCurve, pProfCurve);
+        #endif /* LSP_SHAPER_PROFILING */
+
+            // Synchronize meshes with the UI
+            if (ui_work)
+                sync_meshes();
+        }
+
+        bool shaper::inline_display(plug::ICanvas *cv, size_t width, size_t height)
+        {
+            // Check proportions
+            if (height > (M_RGOLD_RATIO * width))
+                height  = M_RGOLD_RATIO * width;
+
+            // Init canvas
+            if (!cv->init(width, height))
+                return false;
+            width   = cv->width();
+            height  = cv->height();
+
+            const curve_t *curve    = pActiveCurve;
+            if (curve == NULL)
+                return false;
+
+            core::IDBuffer *b       = core::IDBuffer::reuse(pIDisplay, 2, meta::shaper::GRAPH_DOTS);
+            if (b == NULL)
+                return false;
+
+            // The curve itself is sampled by the fit task on the executor
+            // queue; the callback only projects it into screen space, and
+            // even that happens at most once per curve change or resize.
+            // Hosts repainting dozens of static inline displays per frame
+            // otherwise pay the full transform every time
+            const bool refill       =
+                (b != pIDisplay) ||
+                (curve->nVersion != nIDisplayVersion) ||
+                (width != nIDisplayWidth) ||
+                (height != nIDisplayHeight);
+            pIDisplay               = b;
+
+            if (refill)
+            {
+                const float kx          = float(width) / float(meta::shaper::GRAPH_DOTS - 1);
+                const float cy          = 0.5f * height;
+                for (size_t i=0; i<meta::shaper::GRAPH_DOTS; ++i)
+                {
+                    b->v[0][i]              = i * kx;
+                    b->v[1][i]              = cy * (1.0f - curve->vLinGraph[i]);
+                }
+
+                nIDisplayVersion        = curve->nVersion;
+                nIDisplayWidth          = width;
+                nIDisplayHeight         = height;
+            }
+
+            // Clear background
+            const bool bypassing    = vChannels[0].sBypass.bypassing();
+            cv->set_color_rgb((bypassing) ? CV_DISABLED : CV_BACKGROUND);
+            cv->paint();
+
+            // Draw axes through the origin of the transfer function
+            cv->set_line_width(1.0);
+            cv->set_color_rgb(CV_SILVER);
+            cv->line(0, height >> 1, width, height >> 1);
+            cv->line(width >> 1, 0, width >> 1, height);
+
+            // Draw the cached transfer curve polyline
+            cv->set_line_width(2.0);
+            cv->set_color_rgb((bypassing) ? CV_SILVER : CV_MESH);
+            cv->draw_lines(b->v[0], b->v[1], meta::shaper::GRAPH_DOTS);
+
+            return true;
+        }
+
+        void shaper::sync_meshes()
+        {
+            // The meshes are touched only when the curve generation advances
+            // past the one already published to the UI
+            const curve_t *curve    = pActiveCurve;
+            if ((curve == NULL) || (curve->nVersion == nMeshVersion))
+                return;
+
+            plug::mesh_t *mesh  = (pLinMesh != NULL) ? pLinMesh->buffer<plug::mesh_t>() : NULL;
+            if ((mesh == NULL) || (!mesh->isEmpty()))
+                return;
+
+            dsp::copy(mesh->pvData[0], vLinCoord, meta::shaper::GRAPH_DOTS);
+            dsp::copy(mesh->pvData[1], curve->vLinGraph, meta::shaper::GRAPH_DOTS);
+            mesh->data(2, meta::shaper::GRAPH_DOTS);
+
+            // The log graph data appears with the first fit after a UI
+            // attach; the acquire load pairs with the release publication in
+            // alloc_log_graphs() so the graph contents are visible whenever
+            // the pointer is
+            const float *lcoord = atomic_load(&vLogCoord);
+            if ((lcoord == NULL) || (curve->vLogGraph == NULL))
+            {
+                nMeshVersion        = curve->nVersion;
+                return;
+            }
+
+            mesh                = (pLogMesh != NULL) ? pLogMesh->buffer<plug::mesh_t>() : NULL;
+            if ((mesh == NULL) || (!mesh->isEmpty()))
+                return;
+
+            dsp::copy(mesh->pvData[0], lcoord, meta::shaper::GRAPH_DOTS);
+            dsp::copy(mesh->pvData[1], curve->vLogGraph, meta::shaper::GRAPH_DOTS);
+            mesh->data(2, meta::shaper::GRAPH_DOTS);
+
+            nMeshVersion        = curve->nVersion;
+        }
+
+        void shaper::ui_activated()
+        {
+            // Leave the offline fast path and force mesh republication on the
+            // next block; the counter tolerates hosts attaching several views
+            // to the same instance
+            atomic_add(&nUIRefs, 1);
+            nMeshVersion        = 0;
+
+            // Schedule a refit when the log graph data has not been allocated
+            // yet: the fit task performs the allocation and renders the graphs
+            if (vLogCoord == NULL)
+                bCurveDirty         = true;
+        }
+
+        void shaper::ui_deactivated()
+        {
+            if (nUIRefs > 0)
+                atomic_add(&nUIRefs, -1);
+        }
+
+        void shaper::dump(dspu::IStateDumper *v) const
+        {
+            plug::Module::dump(v);
+
+            v->write("nChannels", nChannels);
+            v->begin_array("vChannels", vChannels, nChannels);
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                const channel_t *c      = &vChannels[i];
+                v->begin_object(c, sizeof(channel_t));
+                {
+                    v->write("vIn", c->vIn);
+                    v->write("vOut", c->vOut);
+                    v->write("vBuffer", c->vBuffer);
+                    v->write("vOvsBuffer", c->vOvsBuffer);
+                    v->write("vFadeBuffer", c->vFadeBuffer);
+                    v->write("vModeBuffer", c->vModeBuffer);
+                    v->write("fAdaaX1", c->fAdaaX1);
+                    v->write("fInLevel", c->fInLevel);
+                    v->write("fOutLevel", c->fOutLevel);
+                    v->write_object("sBypass", &c->sBypass);
+                    v->write_object("sOver", &c->sOver);
+                    v->write_object("sDelay", &c->sDelay);
+                    v->write("pIn", c->pIn);
+                    v->write("pOut", c->pOut);
+                    v->write("pInMeter", c->pInMeter);
+                    v->write("pOutMeter", c->pOutMeter);
+                }
+                v->end_object();
+            }
+            v->end_array();
+
+            v->write("vBuffer", vBuffer);
+            v->write("vOvsBuffer", vOvsBuffer);
+            v->write("vFadeBuffer", vFadeBuffer);
+            v->write("vModeBuffer", vModeBuffer);
+            v->write("vMatrix", vMatrix);
+            v->write("vLinCoord", vLinCoord);
+            v->write("vLogCoord", vLogCoord);
+
+            v->begin_array("vCurves", vCurves, CURVES_TOTAL);
+            for (size_t i=0; i<CURVES_TOTAL; ++i)
+            {
+                const curve_t *c        = &vCurves[i];
+                v->begin_object(c, sizeof(curve_t));
+                {
+                    v->write("pEvalK", reinterpret_cast<const void *>(c->pEvalK));
+                    v->write("pEvalKX2", reinterpret_cast<const void *>(c->pEvalKX2));
+                    v->write("vLut", c->vLut);
+                    v->write("nOrder", c->nOrder);
+                    v->write("nMode", c->nMode);
+                    v->writev("vCoeffs", c->vCoeffs, meta::shaper::ORDER_MAX + 1);
+                    v->writev("vAdaaCoeffs", c->vAdaaCoeffs, meta::shaper::ORDER_MAX + 2);
+                    v->writev("vMorphCoeffs", c->vMorphCoeffs, meta::shaper::ORDER_MAX + 1);
+                    v->writev("vMorphAdaaCoeffs", c->vMorphAdaaCoeffs, meta::shaper::ORDER_MAX + 2);
+                    v->writev("vCoeffsB", c->vCoeffsB, meta::shaper::ORDER_MAX + 1);
+                    v->writev("vAdaaCoeffsB", c->vAdaaCoeffsB, meta::shaper::ORDER_MAX + 2);
+                    v->write("fMorphApplied", c->fMorphApplied);
+                    v->write("nVersion", c->nVersion);
+                    v->write("nRefs", c->nRefs);
+                    v->write("vLutLocal", c->vLutLocal);
+                    v->write("pShared", c->pShared);
+                    v->write("vLinGraph", c->vLinGraph);
+                    v->write("vLogGraph", c->vLogGraph);
+                }
+                v->end_object();
+            }
+            v->end_array();
+
+            v->write("pActiveCurve", pActiveCurve);
+            v->write("pFadeCurve", pFadeCurve);
+            v->write("pFitCurve", pFitCurve);
+            v->write("nChunkSize", nChunkSize);
+            v->write("nChunkOverride", nChunkOverride);
+            v->write("nFadeTotal", nFadeTotal);
+            v->write("nFadePos", nFadePos);
+            v->write("nSettleTotal", nSettleTotal);
+            v->write("nSettleLeft", nSettleLeft);
+
+            v->write("nSnapSeq", nSnapSeq);
+            v->write("nSnapVersion", nSnapVersion);
+            v->write("nSnapApplied", nSnapApplied);
+
+            v->write("nOrder", nOrder);
+            v->write("nCurveMode", nCurveMode);
+            v->write("nOversampling", nOversampling);
+            v->write("nOvsQuality", nOvsQuality);
+            v->write("fGainIn", fGainIn);
+            v->write("fGainOut", fGainOut);
+            v->write("fHScale", fHScale);
+            v->write("fHShift", fHShift);
+            v->write("fVScale", fVScale);
+            v->write("fVShift", fVShift);
+            v->write("fHScaleB", fHScaleB);
+            v->write("fHShiftB", fHShiftB);
+            v->write("fVScaleB", fVScaleB);
+            v->write("fVShiftB", fVShiftB);
+            v->write("fMorph", fMorph);
+            v->write("bMorph", bMorph);
+            v->write("bAutoOvs", bAutoOvs);
+            v->write("bAdaa", bAdaa);
+            v->write("bOvsActive", bOvsActive);
+            v->write("nOvsFadePos", nOvsFadePos);
+            v->write("nCurveVersion", nCurveVersion);
+            v->write("nMeshVersion", nMeshVersion);
+            v->write("nUIRefs", nUIRefs);
+            v->write("bListen", bListen);
+            v->write("bDither", bDither);
+            v->write("bCurveDirty", bCurveDirty);
+            v->write("bPoolBound", bPoolBound);
+
+            v->write("pBypass", pBypass);
+            v->write("pGainIn", pGainIn);
+            v->write("pGainOut", pGainOut);
+            v->write("pHScale", pHScale);
+            v->write("pHShift", pHShift);
+            v->write("pVScale", pVScale);
+            v->write("pVShift", pVShift);
+            v->write("pHScaleB", pHScaleB);
+            v->write("pHShiftB", pHShiftB);
+            v->write("pVScaleB", pVScaleB);
+            v->write("pVShiftB", pVShiftB);
+            v->write("pMorph", pMorph);
+            v->write("pOrder", pOrder);
+            v->write("pOversampling", pOversampling);
+            v->write("pOvsQuality", pOvsQuality);
+            v->write("pCurveMode", pCurveMode);
+            v->write("pListen", pListen);
+            v->write("pDither", pDither);
+            v->write("pLinMesh", pLinMesh);
+            v->write("pLogMesh", pLogMesh);
+
+            v->write("pIDisplay", pIDisplay);
+            v->write("nIDisplayVersion", nIDisplayVersion);
+            v->write("nIDisplayWidth", nIDisplayWidth);
+            v->write("nIDisplayHeight", nIDisplayHeight);
+
+            v->write("pData", pData);
+            v->write("pGraphData", pGraphData);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 27 Aug 2026
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/dsp/curve.h>
+#include <private/meta/shaper.h>
+
+#define BLOCK_SIZE      4096
+
+// Per-kernel micro-benchmarks complementing the whole-plugin benchmark in
+// ptest/shaper.cpp: every kernel runs both through the dispatched pointer
+// (the best SIMD variant the host supports) and through the scalar baseline,
+// so one run yields the speedup of the active SIMD path and runs on
+// different architectures are directly comparable
+
+namespace lsp
+{
+    using namespace lsp::plugins;
+}
+
+PTEST_BEGIN("plugins.shaper", curve_kernels, 5, 10000)
+
+    void make_coeffs(float *c, float *ic, size_t order)
+    {
+        // Alternating-sign decaying coefficients resembling a fitted sigmoid;
+        // the exact values are irrelevant for timing, only order matters
+        dsp::fill_zero(c, meta::shaper::ORDER_MAX + 1);
+        dsp::fill_zero(ic, meta::shaper::ORDER_MAX + 2);
+        for (size_t j=0; j<=order; ++j)
+        {
+            c[j]            = ((j & 1) ? -1.0f : 1.0f) / float(j + 1);
+            ic[j+1]         = c[j] / float(j + 1);
+        }
+    }
+
+    void make_signal(float *dst, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+            dst[i]          = 0.5f * sinf((2.0f * M_PI * 440.0f * i) / 48000.0f);
+    }
+
+    void make_lut(float *lut, size_t size)
+    {
+        for (size_t i=0; i<size; ++i)
+        {
+            const float x   = -1.0f + (2.0f * i) / (size - 1);
+            lut[i]          = tanhf(2.0f * x);
+        }
+    }
+
+    void bench_polyeval_k(const char *label, curve::polyeval_k_t func,
+        float *dst, const float *src, const float *c, size_t order)
+    {
+        char buf[0x100];
+        snprintf(buf, sizeof(buf), "polyeval_k %s order=%d", label, int(order));
+        printf("Testing %s, block of %d samples ...\n", buf, BLOCK_SIZE);
+
+        PTEST_LOOP(buf,
+            func(dst, src, c, order, 0.5f, BLOCK_SIZE);
+        );
+    }
+
+    void bench_polyeval_k_x2(const char *label, curve::polyeval_k_x2_t func,
+        float *dst_l, float *dst_r, const float *src_l, const float *src_r, const float *c, size_t order)
+    {
+        char buf[0x100];
+        snprintf(buf, sizeof(buf), "polyeval_k_x2 %s order=%d", label, int(order));
+        printf("Testing %s, block of %d samples ...\n", buf, BLOCK_SIZE);
+
+        PTEST_LOOP(buf,
+            func(dst_l, dst_r, src_l, src_r, c, order, 0.5f, BLOCK_SIZE);
+        );
+    }
+
+    void bench_lut_process_k(const char *label, curve::lut_process_k_t func,
+        float *dst, const float *src, const float *lut)
+    {
+        char buf[0x100];
+        snprintf(buf, sizeof(buf), "lut_process_k %s size=%d", label, int(meta::shaper::CURVE_LUT_SIZE));
+        printf("Testing %s, block of %d samples ...\n", buf, BLOCK_SIZE);
+
+        PTEST_LOOP(buf,
+            func(dst, src, lut, meta::shaper::CURVE_LUT_SIZE, 0.5f, BLOCK_SIZE);
+        );
+    }
+
+    void bench_adaa(const char *label, curve::adaa_t func,
+        float *dst, const float *src, const float *c, const float *ic, size_t order)
+    {
+        char buf[0x100];
+        snprintf(buf, sizeof(buf), "adaa %s order=%d", label, int(order));
+        printf("Testing %s, block of %d samples ...\n", buf, BLOCK_SIZE);
+
+        PTEST_LOOP(buf,
+            func(dst, src, c, ic, order, 0.5f, 0.0f, BLOCK_SIZE);
+        );
+    }
+
+    void bench_polyeval_mix(const char *label, curve::polyeval_mix_t func,
+        float *dst, const float *src, const float *dry, const float *c, size_t order)
+    {
+        char buf[0x100];
+        snprintf(buf, sizeof(buf), "polyeval_mix %s order=%d", label, int(order));
+        printf("Testing %s, block of %d samples ...\n", buf, BLOCK_SIZE);
+
+        PTEST_LOOP(buf,
+            func(dst, src, dry, c, order, 0.7f, 0.3f, BLOCK_SIZE);
+        );
+    }
+
+    void bench_polyfit(double *matrix, const double *x, const double *y, size_t order)
+    {
+        float coeffs[meta::shaper::ORDER_MAX + 1];
+        const size_t np     = (order + 1) * 4;
+
+        char buf[0x100];
+        snprintf(buf, sizeof(buf), "polyfit order=%d points=%d", int(order), int(np));
+        printf("Testing %s ...\n", buf);
+
+        PTEST_LOOP(buf,
+            curve::polyfit(coeffs, matrix, x, y, np, order);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        // Resolve the dispatched kernels for the running architecture and
+        // record the selected family, so baselines gathered on different
+        // machines identify themselves
+        curve::init();
+        printf("Dispatched curve implementation: %s\n", curve::impl_name());
+
+        static const size_t orders[]    = { 4, 8, 16, 32 };
+
+        float c[meta::shaper::ORDER_MAX + 1];
+        float ic[meta::shaper::ORDER_MAX + 2];
+
+        uint8_t *data       = NULL;
+        float *buffers      = alloc_aligned<float>(data,
+            BLOCK_SIZE * 5 + meta::shaper::CURVE_LUT_SIZE, 64);
+        float *src_l        = buffers;
+        float *src_r        = &buffers[BLOCK_SIZE];
+        float *dst_l        = &buffers[BLOCK_SIZE*2];
+        float *dst_r        = &buffers[BLOCK_SIZE*3];
+        float *dry          = &buffers[BLOCK_SIZE*4];
+        float *lut          = &buffers[BLOCK_SIZE*5];
+
+        make_signal(src_l, BLOCK_SIZE);
+        make_signal(src_r, BLOCK_SIZE);
+        make_signal(dry, BLOCK_SIZE);
+        make_lut(lut, meta::shaper::CURVE_LUT_SIZE);
+
+        for (size_t o=0; o<sizeof(orders)/sizeof(orders[0]); ++o)
+        {
+            const size_t order  = orders[o];
+            make_coeffs(c, ic, order);
+
+            // Fused shape+gain: scalar baseline, dispatched SIMD, and the
+            // order-specialized evaluator actually installed by the fit
+            bench_polyeval_k("generic", curve::generic.polyeval_k, dst_l, src_l, c, order);
+            bench_polyeval_k("dispatched", curve::polyeval_k, dst_l, src_l, c, order);
+            const curve::polyeval_k_t spec  = curve::polyeval_k_resolve(order);
+            if (spec != curve::polyeval_k)
+                bench_polyeval_k("specialized", spec, dst_l, src_l, c, order);
+
+            // Paired stereo variant
+            bench_polyeval_k_x2("generic", curve::generic.polyeval_k_x2, dst_l, dst_r, src_l, src_r, c, order);
+            bench_polyeval_k_x2("dispatched", curve::polyeval_k_x2, dst_l, dst_r, src_l, src_r, c, order);
+
+            // Antiderivative antialiasing
+            bench_adaa("generic", curve::generic.adaa, dst_l, src_l, c, ic, order);
+            bench_adaa("dispatched", curve::adaa, dst_l, src_l, c, ic, order);
+
+            // Fused shape+gain+dry mix
+            bench_polyeval_mix("generic", curve::generic.polyeval_mix, dst_l, src_l, dry, c, order);
+            bench_polyeval_mix("dispatched", curve::polyeval_mix, dst_l, src_l, dry, c, order);
+        }
+
+        // Table lookup does not depend on the polynomial order
+        bench_lut_process_k("generic", curve::generic.lut_process_k, dst_l, src_l, lut);
+        bench_lut_process_k("dispatched", curve::lut_process_k, dst_l, src_l, lut);
+
+        // Matrix solve across orders, using a private workspace and the same
+        // sampling density as the plugin's fit task
+        {
+            const size_t max_np = (meta::shaper::ORDER_MAX + 1) * 4;
+            double *matrix      = new double[(meta::shaper::ORDER_MAX + 1) * (meta::shaper::ORDER_MAX + 2)];
+            double *x           = new double[max_np];
+            double *y           = new double[max_np];
+            for (size_t s=0; s<max_np; ++s)
+            {
+                x[s]                = -1.0 + (2.0 * s) / (max_np - 1);
+                y[s]                = tanh(2.0 * x[s]);
+            }
+
+            for (size_t o=0; o<sizeof(orders)/sizeof(orders[0]); ++o)
+                bench_polyfit(matrix, x, y, orders[o]);
+
+            delete [] matrix;
+            delete [] x;
+            delete [] y;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
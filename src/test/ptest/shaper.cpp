@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *
+ * This file is part of lsp-plugins-shaper
+ * Created on: 27 Aug 2026
+ *
+ * lsp-plugins-shaper is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * lsp-plugins-shaper is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-shaper. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/ipc/IExecutor.h>
+#include <lsp-plug.in/ipc/ITask.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/runtime/system.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+
+#include <private/dsp/curve.h>
+#include <private/meta/shaper.h>
+#include <private/plugins/shaper.h>
+
+#define SRATE           96000
+#define MAX_BLOCK       4096
+#define TOTAL_SAMPLES   (1 << 18)
+
+namespace lsp
+{
+    namespace
+    {
+        /**
+         * Executes submitted tasks synchronously so benchmark runs do not
+         * depend on worker thread scheduling. All fits actually take this
+         * path because PTEST_MAIN disables the shared worker pool before
+         * the plugin binds to it
+         */
+        class InlineExecutor: public ipc::IExecutor
+        {
+            public:
+                virtual bool submit(ipc::ITask *task) override
+                {
+                    run_task(task);
+                    return true;
+                }
+        };
+
+        /**
+         * Minimal control/audio port for headless plugin instantiation
+         */
+        class BenchPort: public plug::IPort
+        {
+            private:
+                float               fValue;
+                void               *pBuffer;
+
+            public:
+                explicit BenchPort(const meta::port_t *meta): plug::IPort(meta)
+                {
+                    fValue          = meta->start;
+                    pBuffer         = NULL;
+                }
+
+            public:
+                virtual float       value() override            { return fValue;    }
+                virtual void        set_value(float value) override { fValue = value; }
+                virtual void       *buffer() override           { return pBuffer;   }
+
+            public:
+                void                bind(void *ptr)             { pBuffer = ptr;    }
+        };
+
+        class BenchWrapper: public plug::IWrapper
+        {
+            private:
+                InlineExecutor      sExecutor;
+
+            public:
+                explicit BenchWrapper(plug::Module *plugin): plug::IWrapper(plugin, NULL) {}
+
+            public:
+                virtual ipc::IExecutor *get_executor() override { return &sExecutor; }
+        };
+    } /* namespace */
+} /* namespace lsp */
+
+PTEST_BEGIN("plugins.shaper", shaper, 5, 1000)
+
+    typedef struct config_t
+    {
+        size_t      order;          // Polynomial order
+        size_t      ovs;            // Oversampling selector index
+        size_t      mode;           // Curve evaluation mode
+        size_t      block;          // Host block size
+    } config_t;
+
+    void fill_signal(float *dst, size_t count, size_t kind)
+    {
+        switch (kind)
+        {
+            case 0: // Sine sweep from 20 Hz to 20 kHz
+            {
+                float phase = 0.0f;
+                for (size_t i=0; i<count; ++i)
+                {
+                    const float f   = 20.0f * expf(6.9f * (float(i) / count));
+                    phase          += 2.0f * M_PI * f / SRATE;
+                    dst[i]          = 0.5f * sinf(phase);
+                }
+                break;
+            }
+            case 1: // Program-like material: two tones plus noise floor
+                for (size_t i=0; i<count; ++i)
+                    dst[i]          = 0.3f * sinf(2.0f * M_PI * 110.0f * i / SRATE) +
+                                      0.2f * sinf(2.0f * M_PI * 1733.0f * i / SRATE) +
+                                      0.01f * randf(-1.0f, 1.0f);
+                break;
+            default: // Silence
+                dsp::fill_zero(dst, count);
+                break;
+        }
+    }
+
+    void bench_config(plugins::shaper *plugin, lltl::parray<BenchPort> *ports,
+        float **in, float **out, const float *signal, const config_t *cfg, const char *label)
+    {
+        // Apply the configuration through the control ports
+        for (size_t i=0, n=ports->size(); i<n; ++i)
+        {
+            BenchPort *p        = ports->uget(i);
+            const meta::port_t *meta = p->metadata();
+            if (!strcmp(meta->id, "order"))
+                p->set_value(cfg->order);
+            else if (!strcmp(meta->id, "ovs"))
+                p->set_value(cfg->ovs);
+            else if (!strcmp(meta->id, "cmode"))
+                p->set_value(cfg->mode);
+        }
+        plugin->update_settings();
+
+        // Warm up until the new curve is actually in place: the settle
+        // window defers the refit by CURVE_SETTLE_TIME of audio and the
+        // install crossfades over CURVE_XFADE_TIME, so processing past both
+        // (plus a block of margin) keeps the synchronous fit and the
+        // previous configuration's curve out of the timed loop
+        const size_t settle =
+            size_t((SRATE * (meta::shaper::CURVE_SETTLE_TIME + meta::shaper::CURVE_XFADE_TIME)) / 1000.0f) + cfg->block;
+        for (size_t done=0; done<=settle; done += cfg->block)
+        {
+            dsp::copy(in[0], signal, cfg->block);
+            dsp::copy(in[1], signal, cfg->block);
+            plugin->process(cfg->block);
+        }
+
+        char buf[0x100];
+        snprintf(buf, sizeof(buf), "%s order=%d ovs=%d mode=%d block=%d",
+            label, int(cfg->order), int(cfg->ovs), int(cfg->mode), int(cfg->block));
+        printf("Testing %s ...\n", buf);
+
+        const size_t blocks = TOTAL_SAMPLES / cfg->block;
+
+        PTEST_LOOP(buf,
+            const float *src    = signal;
+            for (size_t b=0; b<blocks; ++b, src += cfg->block)
+            {
+                dsp::copy(in[0], src, cfg->block);
+                dsp::copy(in[1], src, cfg->block);
+                plugin->process(cfg->block);
+            }
+        );
+    }
+
+    PTEST_MAIN
+    {
+        // Record the kernel family the dispatcher selects on this machine,
+        // so per-architecture baselines identify themselves
+        plugins::curve::init();
+        printf("Dispatched curve implementation: %s\n", plugins::curve::impl_name());
+
+        // Disable the shared worker pool before the plugin binds to it, so
+        // fit submissions fall back to the synchronous wrapper executor
+        // instead of real worker threads
+        system::set_env_var("LSP_SHAPER_POOL_SIZE", "0");
+
+        // Instantiate the stereo shaper headlessly
+        plugins::shaper *plugin = new plugins::shaper(&meta::shaper_stereo);
+
+        lltl::parray<BenchPort> ports;
+        plug::IPort *port_list[0x40];
+        size_t n_ports      = 0;
+
+        float *in[2], *out[2];
+        uint8_t *data       = NULL;
+        float *block        = alloc_aligned<float>(data, MAX_BLOCK * 4 + TOTAL_SAMPLES + MAX_BLOCK, 64);
+        in[0]               = block;
+        in[1]               = &block[MAX_BLOCK];
+        out[0]              = &block[MAX_BLOCK*2];
+        out[1]              = &block[MAX_BLOCK*3];
+        float *signal       = &block[MAX_BLOCK*4];
+
+        for (const meta::port_t *p = meta::shaper_stereo.ports; p->id != NULL; ++p)
+        {
+            BenchPort *port     = new BenchPort(p);
+            ports.add(port);
+            port_list[n_ports++]    = port;
+
+            if (meta::is_audio_in_port(p))
+                port->bind(in[(p->id[strlen(p->id)-1] == 'r') ? 1 : 0]);
+            else if (meta::is_audio_out_port(p))
+                port->bind(out[(p->id[strlen(p->id)-1] == 'r') ? 1 : 0]);
+        }
+
+        BenchWrapper wrapper(plugin);
+        plugin->init(&wrapper, port_list);
+        plugin->set_sample_rate(SRATE);
+
+        static const size_t orders[]    = { 4, 8, 16, 32 };
+        static const size_t ovs[]       = { 0, 2, 5 };      // none, 3x, 8x
+        static const size_t blocks[]    = { 64, 512, 4096 };
+        static const char *signals[]    = { "sweep", "program", "silence" };
+
+        for (size_t s=0; s<3; ++s)
+        {
+            fill_signal(signal, TOTAL_SAMPLES + MAX_BLOCK, s);
+
+            for (size_t o=0; o<sizeof(orders)/sizeof(orders[0]); ++o)
+                for (size_t v=0; v<sizeof(ovs)/sizeof(ovs[0]); ++v)
+                    for (size_t b=0; b<sizeof(blocks)/sizeof(blocks[0]); ++b)
+                    {
+                        config_t cfg;
+                        cfg.order       = orders[o];
+                        cfg.ovs         = ovs[v];
+                        cfg.mode        = (o & 1);  // Alternate polynomial/LUT coverage
+                        cfg.block       = blocks[b];
+
+                        bench_config(plugin, &ports, in, out, signal, &cfg, signals[s]);
+                    }
+        }
+
+        plugin->destroy();
+        delete plugin;
+        for (size_t i=0, n=ports.size(); i<n; ++i)
+            delete ports.uget(i);
+        ports.flush();
+        free_aligned(data);
+    }
+
+PTEST_END